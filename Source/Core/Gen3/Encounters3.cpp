@@ -24,64 +24,59 @@
 #include <Core/Gen3/Profile3.hpp>
 #include <Core/Parents/PersonalLoader.hpp>
 #include <Core/Parents/Slot.hpp>
-#include <Core/Resources/Encounters.hpp>
+#include <Core/Util/ResourceLoader.hpp>
 #include <algorithm>
-#include <array>
-#include <cstring>
 #include <iterator>
+#include <map>
+#include <mutex>
 
 namespace Encounters3
 {
     namespace
     {
-        std::vector<std::array<u8, 120>> getData(Game game)
+        std::vector<const u8 *> getData(Game game)
         {
-            const u8 *data;
-            size_t size;
+            std::string name;
 
             if (game == Game::Emerald)
             {
-                data = emerald.data();
-                size = emerald.size();
+                name = "emerald";
             }
             else if (game == Game::FireRed)
             {
-                data = firered.data();
-                size = firered.size();
+                name = "firered";
             }
             else if (game == Game::LeafGreen)
             {
-                data = leafgreen.data();
-                size = leafgreen.size();
+                name = "leafgreen";
             }
             else if (game == Game::Ruby)
             {
-                data = ruby.data();
-                size = ruby.size();
+                name = "ruby";
             }
             else
             {
-                data = sapphire.data();
-                size = sapphire.size();
+                name = "sapphire";
             }
 
-            std::vector<std::array<u8, 120>> encounters;
-            for (size_t i = 0; i < size; i += 120)
+            // Records are read in place from the decompressed resource
+            const std::vector<u8> &resource = ResourceLoader::getResource(name);
+
+            std::vector<const u8 *> encounters;
+            for (size_t i = 0; i < resource.size(); i += 120)
             {
-                std::array<u8, 120> entry;
-                std::memcpy(entry.data(), data + i, 120);
-                encounters.emplace_back(entry);
+                encounters.emplace_back(resource.data() + i);
             }
 
             return encounters;
         }
 
-        u16 getValue(const std::array<u8, 120> &data, int offset)
+        u16 getValue(const u8 *data, int offset)
         {
             return static_cast<u16>(data[offset] << 8) | data[offset + 1];
         }
 
-        std::vector<EncounterArea3> getArea(const std::array<u8, 120> &data, const PersonalInfo *info)
+        std::vector<EncounterArea3> getArea(const u8 *data, const PersonalInfo *info)
         {
             std::vector<EncounterArea3> encounters;
 
@@ -156,19 +151,41 @@ namespace Encounters3
             }
             return encounters;
         }
+
+        // Areas only depend on the game, parse each game once and share it between calls
+        std::map<Game, std::vector<EncounterArea3>> cache;
+        std::mutex mutex;
+
+        const std::vector<EncounterArea3> &getCachedAreas(Game game)
+        {
+            auto it = cache.find(game);
+            if (it == cache.end())
+            {
+                const auto *info = PersonalLoader3::getPersonal();
+
+                std::vector<EncounterArea3> areas;
+                for (const u8 *data : getData(game))
+                {
+                    auto area = getArea(data, info);
+                    areas.insert(areas.end(), area.begin(), area.end());
+                }
+
+                it = cache.emplace(game, std::move(areas)).first;
+            }
+
+            return it->second;
+        }
     }
 
     std::vector<EncounterArea3> getEncounters(Encounter encounter, const Profile3 &profile)
     {
-        std::vector<EncounterArea3> encounters;
-        const auto *info = PersonalLoader3::getPersonal();
+        std::lock_guard<std::mutex> lock(mutex);
 
-        for (const auto &data : getData(profile.getVersion()))
-        {
-            auto areas = getArea(data, info);
-            std::copy_if(areas.begin(), areas.end(), std::back_inserter(encounters),
-                         [&encounter](const EncounterArea3 &area) { return area.getEncounter() == encounter; });
-        }
+        const auto &areas = getCachedAreas(profile.getVersion());
+
+        std::vector<EncounterArea3> encounters;
+        std::copy_if(areas.begin(), areas.end(), std::back_inserter(encounters),
+                     [&encounter](const EncounterArea3 &area) { return area.getEncounter() == encounter; });
 
         return encounters;
     }
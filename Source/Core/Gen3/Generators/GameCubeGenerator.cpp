@@ -22,6 +22,58 @@
 #include <Core/Enum/ShadowType.hpp>
 #include <Core/Parents/Filters/StateFilter.hpp>
 #include <Core/RNG/LCRNG.hpp>
+#include <algorithm>
+#include <future>
+
+namespace
+{
+    // Reroll progress of a single nature lock for advances of the same parity
+    // Later advances start their reroll at or after the previous start and share every PID after that point
+    // They land on the same accepted PID unless they start past it so the search only ever moves forward
+    class LockCursor
+    {
+    public:
+        explicit LockCursor(u32 seed) : seed(seed), position(0), pid(0)
+        {
+        }
+
+        u64 reroll(u64 start, const LockInfo &lock)
+        {
+            if (start < position)
+            {
+                return position;
+            }
+
+            XDRNG rng(XDRNG::advance(seed, static_cast<u32>(start - position)));
+            do
+            {
+                u16 high = rng.nextUShort();
+                u16 low = rng.nextUShort();
+                pid = (high << 16) | low;
+                start += 2;
+            } while (!lock.compare(pid));
+
+            seed = rng.getSeed();
+            position = start;
+            return position;
+        }
+
+        u32 getPID() const
+        {
+            return pid;
+        }
+
+        u32 getSeed() const
+        {
+            return seed;
+        }
+
+    private:
+        u32 seed;
+        u64 position;
+        u32 pid;
+    };
+}
 
 GameCubeGenerator::GameCubeGenerator(u32 initialAdvances, u32 maxAdvances, u16 tid, u16 sid, u8 genderRatio, Method method,
                                      const StateFilter &filter) :
@@ -31,19 +83,49 @@ GameCubeGenerator::GameCubeGenerator(u32 initialAdvances, u32 maxAdvances, u16 t
 
 std::vector<GameCubeState> GameCubeGenerator::generate(u32 seed) const
 {
-    switch (method)
+    std::vector<GameCubeState> states;
+    generate(seed, states);
+    return states;
+}
+
+std::vector<GameCubeState> GameCubeGenerator::generate(const std::vector<u32> &seeds, int threads) const
+{
+    if (threads < 1)
     {
-    case Method::XDColo:
-        return generateXDColo(seed);
-    case Method::XD:
-        return generateXDShadow(seed);
-    case Method::Colo:
-        return generateColoShadow(seed);
-    case Method::Channel:
-        return generateChannel(seed);
-    default:
-        return std::vector<GameCubeState>();
+        threads = 1;
+    }
+    else if (static_cast<size_t>(threads) > seeds.size())
+    {
+        threads = std::max(static_cast<int>(seeds.size()), 1);
     }
+
+    std::vector<std::future<std::vector<GameCubeState>>> threadContainer;
+
+    size_t split = seeds.size() / threads;
+    size_t start = 0;
+    for (int i = 0; i < threads; i++)
+    {
+        size_t end = i == threads - 1 ? seeds.size() : start + split;
+        threadContainer.emplace_back(std::async(std::launch::async, [=, &seeds] {
+            std::vector<GameCubeState> states;
+            for (size_t j = start; j < end; j++)
+            {
+                generate(seeds[j], states);
+            }
+            return states;
+        }));
+        start += split;
+    }
+
+    // Each thread handles a contiguous run of seeds so appending in order keeps the results grouped by seed
+    std::vector<GameCubeState> states;
+    for (int i = 0; i < threads; i++)
+    {
+        auto shard = threadContainer[i].get();
+        states.insert(states.end(), std::make_move_iterator(shard.begin()), std::make_move_iterator(shard.end()));
+    }
+
+    return states;
 }
 
 void GameCubeGenerator::setShadowTeam(u8 index, u8 type)
@@ -52,10 +134,37 @@ void GameCubeGenerator::setShadowTeam(u8 index, u8 type)
     this->type = type;
 }
 
-std::vector<GameCubeState> GameCubeGenerator::generateXDColo(u32 seed) const
+void GameCubeGenerator::generate(u32 seed, std::vector<GameCubeState> &states) const
 {
-    std::vector<GameCubeState> states;
+    size_t size = states.size();
+
+    switch (method)
+    {
+    case Method::XDColo:
+        generateXDColo(seed, states);
+        break;
+    case Method::XD:
+        generateXDShadow(seed, states);
+        break;
+    case Method::Colo:
+        generateColoShadow(seed, states);
+        break;
+    case Method::Channel:
+        generateChannel(seed, states);
+        break;
+    default:
+        break;
+    }
+
+    // Tag everything this seed produced with its source seed
+    for (size_t i = size; i < states.size(); i++)
+    {
+        states[i].setSeed(seed);
+    }
+}
 
+void GameCubeGenerator::generateXDColo(u32 seed, std::vector<GameCubeState> &states) const
+{
     XDRNG rng(seed);
     rng.advance(initialAdvances + offset);
 
@@ -86,54 +195,48 @@ std::vector<GameCubeState> GameCubeGenerator::generateXDColo(u32 seed) const
             states.emplace_back(state);
         }
     }
-
-    return states;
 }
 
-std::vector<GameCubeState> GameCubeGenerator::generateXDShadow(u32 seed) const
+void GameCubeGenerator::generateXDShadow(u32 seed, std::vector<GameCubeState> &states) const
 {
-    std::vector<GameCubeState> states;
-
     XDRNG rng(seed);
     rng.advance(initialAdvances + offset);
 
-    std::vector<LockInfo> locks = team.getLocks();
+    // Enemy TID/SID: 2 advances
+    // Every lock is a temporary PID (2 advances), IVs (2 advances) and ability (1 advance) followed by PID rerolls
+    // If we are looking at a shadow pokemon we will assume it is already set and skip the PID process
+    std::vector<LockInfo> teamLocks = team.getLocks();
+    std::vector<std::pair<u32, LockInfo>> locks;
+    u32 gap = 2;
+    for (auto lock = teamLocks.rbegin(); lock != teamLocks.rend(); lock++)
+    {
+        gap += 5;
+        if (!lock->getFree())
+        {
+            locks.emplace_back(gap, *lock);
+            gap = 0;
+        }
+    }
+
+    // Each parity of advances gets its own cursor per lock
+    std::vector<LockCursor> cursors(locks.size() * 2, LockCursor(rng.getSeed()));
 
     for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rng.next())
     {
         GameCubeState state(initialAdvances + cnt);
 
-        XDRNG go(rng.getSeed());
-
-        // Enemy TID/SID
-        go.advance(2);
-
-        for (auto lock = locks.rbegin(); lock != locks.rend(); lock++)
+        u64 position = cnt;
+        u32 current = rng.getSeed();
+        auto cursor = cursors.begin() + (cnt & 1) * locks.size();
+        for (const auto &lock : locks)
         {
-            // Temporary PID: 2 advances
-            // IVs: 2 advances
-            // Ability: 1 state
-            go.advance(5);
-
-            // If we are looking at a shadow pokemon
-            // We will assume it is already set and skip the PID process
-            if (!lock->getFree())
-            {
-                u32 pid;
-                do
-                {
-                    u16 high = go.nextUShort();
-                    u16 low = go.nextUShort();
-                    pid = (high << 16) | low;
-
-                    if ((high ^ low ^ tsv) < 8) // Shiny lock is from TSV of savefile
-                    {
-                        continue;
-                    }
-                } while (!lock->compare(pid));
-            }
+            position = cursor->reroll(position + lock.first, lock.second);
+            current = cursor->getSeed();
+            cursor++;
         }
 
+        XDRNG go(XDRNG::advance(current, gap));
+
         if (team.getType() == ShadowType::SecondShadow || team.getType() == ShadowType::Salamence)
         {
             go.advance(5); // Set and Unset start the same
@@ -175,49 +278,35 @@ std::vector<GameCubeState> GameCubeGenerator::generateXDShadow(u32 seed) const
             states.emplace_back(state);
         }
     }
-
-    return states;
 }
 
-std::vector<GameCubeState> GameCubeGenerator::generateColoShadow(u32 seed) const
+void GameCubeGenerator::generateColoShadow(u32 seed, std::vector<GameCubeState> &states) const
 {
-    std::vector<GameCubeState> states;
-
     XDRNG rng(seed);
     rng.advance(initialAdvances + offset);
 
+    // Trainer TID/SID: 2 advances
+    // Every lock is a temporary PID (2 advances), IVs (2 advances) and ability (1 advance) followed by PID rerolls
     std::vector<LockInfo> locks = team.getLocks();
 
+    // Each parity of advances gets its own cursor per lock
+    std::vector<LockCursor> cursors(locks.size() * 2, LockCursor(rng.getSeed()));
+
     for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rng.next())
     {
         GameCubeState state(initialAdvances + cnt);
 
         XDRNG go(rng.getSeed());
-
-        // Trainer TID/SID
         u16 trainerTSV = go.nextUShort() ^ go.nextUShort();
 
-        u8 ability;
-        u32 pid;
-        for (auto lock = locks.rbegin(); lock != locks.rend(); lock++)
+        u64 position = cnt + 2;
+        u64 start = position;
+        auto cursor = cursors.begin() + (cnt & 1) * locks.size();
+        for (auto lock = locks.rbegin(); lock != locks.rend(); lock++, cursor++)
         {
-            // Temporary PID: 2 advances
-            // IVs: 2 advances
-            // Ability: 1 state
-            go.advance(4);
-            ability = go.nextUShort() & 1;
-
-            do
-            {
-                u16 high = go.nextUShort();
-                u16 low = go.nextUShort();
-                pid = (high << 16) | low;
-
-                if ((high ^ low ^ trainerTSV) < 8) // Shiny lock is from enemy TSV
-                {
-                    continue;
-                }
-            } while (!lock->compare(pid));
+            start = position + 5;
+            position = cursor->reroll(start, *lock);
+            go.setSeed(cursor->getSeed());
         }
 
         // E-Reader is included as part of the above loop
@@ -225,6 +314,9 @@ std::vector<GameCubeState> GameCubeGenerator::generateColoShadow(u32 seed) const
         // IVs are 0
         if (team.getType() == ShadowType::EReader)
         {
+            u32 pid = (cursor - 1)->getPID();
+            u8 ability = (XDRNGR::advance(go.getSeed(), static_cast<u32>(position - start)) >> 16) & 1;
+
             state.setIVs(0);
             state.calculateHiddenPower();
 
@@ -264,14 +356,10 @@ std::vector<GameCubeState> GameCubeGenerator::generateColoShadow(u32 seed) const
             states.emplace_back(state);
         }
     }
-
-    return states;
 }
 
-std::vector<GameCubeState> GameCubeGenerator::generateChannel(u32 seed) const
+void GameCubeGenerator::generateChannel(u32 seed, std::vector<GameCubeState> &states) const
 {
-    std::vector<GameCubeState> states;
-
     XDRNG rng(seed);
     rng.advance(initialAdvances + offset);
 
@@ -318,6 +406,4 @@ std::vector<GameCubeState> GameCubeGenerator::generateChannel(u32 seed) const
             states.emplace_back(state);
         }
     }
-
-    return states;
 }
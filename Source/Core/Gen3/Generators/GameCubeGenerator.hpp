@@ -31,16 +31,18 @@ public:
     GameCubeGenerator() = default;
     GameCubeGenerator(u32 initialAdvances, u32 maxAdvances, u16 tid, u16 sid, u8 genderRatio, Method method, const StateFilter &filter);
     std::vector<GameCubeState> generate(u32 seed) const;
+    std::vector<GameCubeState> generate(const std::vector<u32> &seeds, int threads) const;
     void setShadowTeam(u8 index, u8 type);
 
 private:
     ShadowTeam team;
     u8 type;
 
-    std::vector<GameCubeState> generateXDColo(u32 seed) const;
-    std::vector<GameCubeState> generateXDShadow(u32 seed) const;
-    std::vector<GameCubeState> generateColoShadow(u32 seed) const;
-    std::vector<GameCubeState> generateChannel(u32 seed) const;
+    void generate(u32 seed, std::vector<GameCubeState> &states) const;
+    void generateXDColo(u32 seed, std::vector<GameCubeState> &states) const;
+    void generateXDShadow(u32 seed, std::vector<GameCubeState> &states) const;
+    void generateColoShadow(u32 seed, std::vector<GameCubeState> &states) const;
+    void generateChannel(u32 seed, std::vector<GameCubeState> &states) const;
 };
 
 #endif // GAMECUBEGENERATOR_HPP
@@ -21,6 +21,8 @@
 #include <Core/Enum/Method.hpp>
 #include <Core/Parents/Filters/StateFilter.hpp>
 #include <Core/RNG/LCRNG.hpp>
+#include <algorithm>
+#include <future>
 
 PokeSpotGenerator::PokeSpotGenerator(u32 initialAdvances, u32 maxAdvances, u16 tid, u16 sid, u8 genderRatio, const StateFilter &filter) :
     Generator(initialAdvances, maxAdvances, tid, sid, genderRatio, Method::XDColo, filter)
@@ -30,7 +32,52 @@ PokeSpotGenerator::PokeSpotGenerator(u32 initialAdvances, u32 maxAdvances, u16 t
 std::vector<GameCubeState> PokeSpotGenerator::generate(u32 seed, const std::vector<bool> &spots) const
 {
     std::vector<GameCubeState> states;
+    generate(seed, spots, states);
+    return states;
+}
+
+std::vector<GameCubeState> PokeSpotGenerator::generate(const std::vector<u32> &seeds, const std::vector<bool> &spots, int threads) const
+{
+    if (threads < 1)
+    {
+        threads = 1;
+    }
+    else if (static_cast<size_t>(threads) > seeds.size())
+    {
+        threads = std::max(static_cast<int>(seeds.size()), 1);
+    }
+
+    std::vector<std::future<std::vector<GameCubeState>>> threadContainer;
+
+    size_t split = seeds.size() / threads;
+    size_t start = 0;
+    for (int i = 0; i < threads; i++)
+    {
+        size_t end = i == threads - 1 ? seeds.size() : start + split;
+        threadContainer.emplace_back(std::async(std::launch::async, [=, &seeds, &spots] {
+            std::vector<GameCubeState> states;
+            for (size_t j = start; j < end; j++)
+            {
+                generate(seeds[j], spots, states);
+            }
+            return states;
+        }));
+        start += split;
+    }
+
+    // Each thread handles a contiguous run of seeds so appending in order keeps the results grouped by seed
+    std::vector<GameCubeState> states;
+    for (int i = 0; i < threads; i++)
+    {
+        auto shard = threadContainer[i].get();
+        states.insert(states.end(), std::make_move_iterator(shard.begin()), std::make_move_iterator(shard.end()));
+    }
 
+    return states;
+}
+
+void PokeSpotGenerator::generate(u32 seed, const std::vector<bool> &spots, std::vector<GameCubeState> &states) const
+{
     XDRNG rng(seed);
     rng.advance(initialAdvances);
 
@@ -76,6 +123,7 @@ std::vector<GameCubeState> PokeSpotGenerator::generate(u32 seed, const std::vect
                 u16 high = go.nextUShort();
                 u16 low = go.nextUShort();
 
+                state.setSeed(seed);
                 state.setPID(high, low);
                 state.setAbility(low & 1);
                 state.setGender(low & 255, genderRatio);
@@ -89,6 +137,4 @@ std::vector<GameCubeState> PokeSpotGenerator::generate(u32 seed, const std::vect
             }
         }
     }
-
-    return states;
 }
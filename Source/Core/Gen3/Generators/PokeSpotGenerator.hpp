@@ -29,6 +29,10 @@ public:
     PokeSpotGenerator() = default;
     PokeSpotGenerator(u32 initialAdvances, u32 maxAdvances, u16 tid, u16 sid, u8 genderRatio, const StateFilter &filter);
     std::vector<GameCubeState> generate(u32 seed, const std::vector<bool> &spots) const;
+    std::vector<GameCubeState> generate(const std::vector<u32> &seeds, const std::vector<bool> &spots, int threads) const;
+
+private:
+    void generate(u32 seed, const std::vector<bool> &spots, std::vector<GameCubeState> &states) const;
 };
 
 #endif // POKESPOTGENERATOR_HPP
@@ -18,6 +18,7 @@
  */
 
 #include "ChannelSeedSearcher.hpp"
+#include <Core/RNG/SIMD.hpp>
 #include <algorithm>
 #include <future>
 
@@ -61,6 +62,92 @@ int ChannelSeedSearcher::getProgress() const
 }
 
 void ChannelSeedSearcher::search(u32 start, u32 end)
+{
+    // The first pattern decides which order the 3 non-zero values (and optionally a leading zero) have to appear in
+    // Patterns are built as sum(num << position) so each of the 6 orders produces a unique value
+    constexpr u8 orders[6][4] = { { 11, 3, 2, 1 }, { 12, 2, 3, 1 }, { 13, 3, 1, 2 },
+                                  { 15, 1, 3, 2 }, { 16, 2, 1, 3 }, { 17, 1, 2, 3 } };
+
+    u32 compare = criteria.empty() ? 0 : criteria[0];
+    bool zero = compare > 20;
+    u32 base = zero ? compare >> 1 : compare;
+
+    auto order = std::find_if(std::begin(orders), std::end(orders), [base](const u8 *order) { return order[0] == base; });
+    if (order == std::end(orders) || (zero && (compare & 1)))
+    {
+        // Pattern can't be filtered ahead of time, verify every seed directly
+        searchScalar(start, end);
+        return;
+    }
+
+    vuint32x4 mult = v32x4_set(0x343FD);
+    vuint32x4 add = v32x4_set(0x269EC3);
+    vuint32x4 numA = v32x4_set((*order)[1]);
+    vuint32x4 numB = v32x4_set((*order)[2]);
+    vuint32x4 numC = v32x4_set((*order)[3]);
+    vuint32x4 zeroes = v32x4_set(0);
+    vuint32x4 ones = v32x4_set(1);
+    vuint32x4 twos = v32x4_set(2);
+    vuint32x4 threes = v32x4_set(3);
+    vuint32x4 full = v32x4_set(0xffffffff);
+
+    u32 seed = start;
+    for (; end - seed >= 4; seed += 4)
+    {
+        if (!searching)
+        {
+            return;
+        }
+
+        vuint32x4 seeds = v32x4_set(seed, seed + 1, seed + 2, seed + 3);
+
+        // First call has to be a zero or the first value of the order
+        seeds = v32x4_add(v32x4_mul(seeds, mult), add);
+        vuint32x4 num = v32x4_shr<30>(seeds);
+        vuint32x4 isZero = v32x4_cmpeq(num, zeroes);
+
+        vuint32x4 alive = zero ? isZero : v32x4_cmpeq(num, numA);
+        vuint32x4 found = zero ? zeroes : ones;
+        vuint32x4 done = zeroes;
+
+        // Afterwards each call is either ignored (zero or a value already found), the next value in the order, or a mismatch
+        while (v32x4_movemask(v32x4_and(alive, v32x4_xor(done, full))) != 0)
+        {
+            seeds = v32x4_add(v32x4_mul(seeds, mult), add);
+            num = v32x4_shr<30>(seeds);
+            isZero = v32x4_cmpeq(num, zeroes);
+
+            vuint32x4 position = v32x4_or(v32x4_and(v32x4_cmpeq(num, numB), ones), v32x4_and(v32x4_cmpeq(num, numC), twos));
+            vuint32x4 mismatch = v32x4_and(v32x4_xor(isZero, full), v32x4_cmpgt(position, found));
+            vuint32x4 next = v32x4_and(v32x4_xor(v32x4_or(isZero, done), full), v32x4_cmpeq(position, found));
+
+            alive = v32x4_and(alive, v32x4_or(v32x4_xor(mismatch, full), done));
+            found = v32x4_add(found, v32x4_and(next, ones));
+            done = v32x4_or(done, v32x4_cmpeq(found, threes));
+        }
+
+        int mask = v32x4_movemask(alive);
+        progress += 4;
+
+        // Only the survivors are checked against every pattern
+        for (u8 lane = 0; mask != 0; lane++, mask >>= 1)
+        {
+            if (mask & 1)
+            {
+                XDRNG rng(seed + lane);
+                if (searchSeed(rng))
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    results.emplace_back(rng.getSeed());
+                }
+            }
+        }
+    }
+
+    searchScalar(seed, end);
+}
+
+void ChannelSeedSearcher::searchScalar(u32 start, u32 end)
 {
     for (u32 seed = start; seed < end; seed++)
     {
@@ -32,6 +32,7 @@ public:
 
 private:
     void search(u32 start, u32 end);
+    void searchScalar(u32 start, u32 end);
     bool searchSeed(XDRNG &rng);
 };
 
@@ -19,12 +19,46 @@
 
 #include "GalesSeedSearcher.hpp"
 #include <algorithm>
+#include <array>
 #include <cstring>
 #include <future>
 
 constexpr u16 hpStat[10][2] = { { 322, 340 }, { 310, 290 }, { 210, 620 }, { 320, 230 }, { 310, 310 },
                                 { 290, 310 }, { 290, 270 }, { 290, 250 }, { 320, 270 }, { 270, 230 } };
 
+namespace
+{
+    using IndexTable = std::array<std::array<std::vector<std::pair<u32, u32>>, 5>, 5>;
+
+    // Groups every upper half of the player index call by its player index and (high * 0x43FD) & 0xffff % 5
+    // Each group is sorted by (high * 0x43FD) & 0xffff so the search can split it where the enemy index call wraps around
+    IndexTable buildIndexTable()
+    {
+        IndexTable table;
+        for (u32 high = 0; high < 0x10000; high++)
+        {
+            u32 mult = (high * 0x43FD) & 0xffff;
+            table[high % 5][mult % 5].emplace_back(mult, high);
+        }
+
+        for (auto &player : table)
+        {
+            for (auto &group : player)
+            {
+                std::sort(group.begin(), group.end());
+            }
+        }
+
+        return table;
+    }
+
+    const IndexTable &getIndexTable()
+    {
+        static const IndexTable table = buildIndexTable();
+        return table;
+    }
+}
+
 GalesSeedSearcher::GalesSeedSearcher(const std::vector<u32> &criteria, u16 tsv) : SeedSearcher(criteria), tsv(tsv)
 {
 }
@@ -98,27 +132,76 @@ void GalesSeedSearcher::startSearch(int threads, const std::vector<u32> &seeds)
 
 void GalesSeedSearcher::search(u32 start, u32 end)
 {
+    const auto &table = getIndexTable();
+    u8 playerIndex = criteria[0];
+    u8 enemyIndex = criteria[1];
+    u32 count = (0x10000 - playerIndex + 4) / 5;
+
+    // The HP IV of the first enemy Pokemon is always 7 calls after the player index call
+    // With the EVs only able to add 0-63 HP this limits which IVs can produce the HP being searched for
+    u32 ivMask = 0;
+    for (u8 iv = 0; iv < 32; iv++)
+    {
+        int evs = static_cast<int>(criteria[4]) - hpStat[enemyIndex + 5][0] - iv;
+        if (evs >= 0 && evs <= 63)
+        {
+            ivMask |= 1 << iv;
+        }
+    }
+
     for (u32 low = start; low < end; low++)
     {
-        for (u32 high = criteria[0]; high < 0x10000; high += 5)
+        // The upper half of the enemy index call is (high * 0x43FD + carry) & 0xffff where carry only depends on the lower half
+        // Only the entries whose remainder lines up with the enemy index (accounting for the wrap around) have to be simulated
+        u16 carry = ((static_cast<u64>(low) * 0x343FD + 0x269EC3) >> 16) & 0xffff;
+        u32 wrap = 0x10000 - carry;
+
+        const auto &noWrap = table[playerIndex][(enemyIndex + 5 - carry % 5) % 5];
+        const auto &withWrap = table[playerIndex][(enemyIndex + 6 - carry % 5) % 5];
+
+        auto noWrapEnd = std::lower_bound(noWrap.begin(), noWrap.end(), std::make_pair(wrap, 0U));
+        auto withWrapBegin = std::lower_bound(withWrap.begin(), withWrap.end(), std::make_pair(wrap, 0U));
+
+        for (auto it = noWrap.begin(); it != noWrapEnd; it++)
         {
             if (!searching)
             {
                 return;
             }
+            searchIndex(it->second, low, ivMask);
+        }
 
-            XDRNGR reverse((high << 16) | low);
-            reverse.next();
-
-            XDRNG rng(reverse.next());
-            if (searchSeed(rng))
+        for (auto it = withWrapBegin; it != withWrap.end(); it++)
+        {
+            if (!searching)
             {
-                std::lock_guard<std::mutex> lock(mutex);
-                results.emplace_back(rng.getSeed());
+                return;
             }
-
-            progress++;
+            searchIndex(it->second, low, ivMask);
         }
+
+        progress += count;
+    }
+}
+
+void GalesSeedSearcher::searchIndex(u32 high, u32 low, u32 ivMask)
+{
+    u32 seed = (high << 16) | low;
+
+    u8 hpIV = (XDRNG::advance(seed, 7) >> 16) & 31;
+    if (((ivMask >> hpIV) & 1) == 0)
+    {
+        return;
+    }
+
+    XDRNGR reverse(seed);
+    reverse.next();
+
+    XDRNG rng(reverse.next());
+    if (searchSeed(rng))
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        results.emplace_back(rng.getSeed());
     }
 }
 
@@ -34,6 +34,7 @@ private:
     u16 tsv;
 
     void search(u32 start, u32 end);
+    void searchIndex(u32 high, u32 low, u32 ivMask);
     void search(const std::vector<u32> &seeds);
     bool searchSeed(XDRNG &rng);
     void generatePokemon(XDRNG &rng) const;
@@ -118,9 +118,11 @@ std::vector<GameCubeState> GameCubeSearcher::searchXDColo(u8 hp, u8 atk, u8 def,
         return states;
     }
 
-    auto seeds = RNGEuclidean::recoverLower16BitsIV(hp, atk, def, spa, spd, spe);
-    for (const auto &pair : seeds)
+    std::pair<u32, u32> seeds[7];
+    u8 count = RNGEuclidean::recoverLower16BitsIV(hp, atk, def, spa, spd, spe, seeds);
+    for (u8 i = 0; i < count; i++)
     {
+        const auto &pair = seeds[i];
         // Setup normal state
         XDRNG rng(pair.second);
 
@@ -164,9 +166,11 @@ std::vector<GameCubeState> GameCubeSearcher::searchXDShadow(u8 hp, u8 atk, u8 de
         return states;
     }
 
-    auto seeds = RNGEuclidean::recoverLower16BitsIV(hp, atk, def, spa, spd, spe);
-    for (const auto &pair : seeds)
+    std::pair<u32, u32> seeds[7];
+    u8 count = RNGEuclidean::recoverLower16BitsIV(hp, atk, def, spa, spd, spe, seeds);
+    for (u8 i = 0; i < count; i++)
     {
+        const auto &pair = seeds[i];
         // Setup normal state
         XDRNG rng(pair.second);
 
@@ -307,9 +311,11 @@ std::vector<GameCubeState> GameCubeSearcher::searchColoShadow(u8 hp, u8 atk, u8
         return states;
     }
 
-    auto seeds = RNGEuclidean::recoverLower16BitsIV(hp, atk, def, spa, spd, spe);
-    for (const auto &pair : seeds)
+    std::pair<u32, u32> seeds[7];
+    u8 count = RNGEuclidean::recoverLower16BitsIV(hp, atk, def, spa, spd, spe, seeds);
+    for (u8 i = 0; i < count; i++)
     {
+        const auto &pair = seeds[i];
         // Setup normal state
         XDRNG rng(pair.second);
 
@@ -19,6 +19,7 @@
 
 #include "RTCSearcher.hpp"
 #include <Core/RNG/LCRNG.hpp>
+#include <algorithm>
 
 RTCSearcher::RTCSearcher() : searching(false)
 {
@@ -33,32 +34,22 @@ void RTCSearcher::startSearch(u32 initialSeed, u32 targetSeed, u32 initialAdvanc
 
     targetSeed = back.getSeed();
 
-    for (Date date; date < end; date = date.addDays(1))
+    int days = Date().daysTo(end);
+    if (days <= 0)
     {
-        for (u8 hour = 0; hour < 24; hour++)
-        {
-            for (u8 minute = 0; minute < 60; minute++)
-            {
-                for (u8 second = 0; second < 60; second++, initialSeed += 40500000)
-                {
-                    XDRNG rng(initialSeed);
-
-                    for (u32 x = 0; x < maxAdvances; x++)
-                    {
-                        if (!searching)
-                        {
-                            return;
-                        }
-
-                        if (rng.next() == targetSeed)
-                        {
-                            std::lock_guard<std::mutex> guard(mutex);
-                            results.emplace_back(DateTime(date, Time(hour, minute, second)), initialSeed, x + 1 + initialAdvances);
-                        }
-                    }
-                }
-            }
-        }
+        return;
+    }
+
+    u64 seconds = static_cast<u64>(days) * 86400;
+
+    // Pick whichever side of the search is smaller to iterate over
+    if (maxAdvances < seconds)
+    {
+        searchAdvances(initialSeed, targetSeed, initialAdvances, maxAdvances, seconds);
+    }
+    else
+    {
+        searchSeconds(initialSeed, targetSeed, initialAdvances, maxAdvances, seconds);
     }
 }
 
@@ -73,3 +64,69 @@ std::vector<GameCubeRTCState> RTCSearcher::getResults()
     auto data = std::move(results);
     return data;
 }
+
+void RTCSearcher::searchAdvances(u32 initialSeed, u32 targetSeed, u32 initialAdvances, u32 maxAdvances, u64 seconds)
+{
+    // Each second adds 40500000 (0x269FB20) to the seed which is 2^5 * 1265625
+    // Solving initialSeed + k * 40500000 = seed therefore only works when the difference is divisible by 32
+    // and the solutions for k repeat every 2^27 seconds
+    constexpr u32 step = 40500000 >> 5;
+    u32 inverse = step;
+    for (u8 i = 0; i < 5; i++)
+    {
+        inverse *= 2 - step * inverse;
+    }
+
+    std::vector<std::pair<u64, u32>> matches;
+
+    XDRNGR rng(targetSeed);
+    for (u32 x = 0; x < maxAdvances; x++)
+    {
+        if (!searching)
+        {
+            return;
+        }
+
+        u32 diff = rng.next() - initialSeed;
+        if ((diff & 0x1f) == 0)
+        {
+            for (u64 k = ((diff >> 5) * inverse) & 0x7ffffff; k < seconds; k += 0x8000000)
+            {
+                matches.emplace_back(k, x + 1 + initialAdvances);
+            }
+        }
+    }
+
+    std::sort(matches.begin(), matches.end());
+
+    std::vector<GameCubeRTCState> states;
+    states.reserve(matches.size());
+    for (const auto &match : matches)
+    {
+        DateTime dateTime(Date().addDays(static_cast<int>(match.first / 86400)), Time(static_cast<int>(match.first % 86400)));
+        states.emplace_back(dateTime, static_cast<u32>(initialSeed + match.first * 40500000), match.second);
+    }
+
+    std::lock_guard<std::mutex> guard(mutex);
+    results.insert(results.end(), states.begin(), states.end());
+}
+
+void RTCSearcher::searchSeconds(u32 initialSeed, u32 targetSeed, u32 initialAdvances, u32 maxAdvances, u64 seconds)
+{
+    for (u64 k = 0; k < seconds; k++, initialSeed += 40500000)
+    {
+        if (!searching)
+        {
+            return;
+        }
+
+        u32 advances = XDRNG::distance(initialSeed, targetSeed);
+        if (advances != 0 && advances <= maxAdvances)
+        {
+            DateTime dateTime(Date().addDays(static_cast<int>(k / 86400)), Time(static_cast<int>(k % 86400)));
+
+            std::lock_guard<std::mutex> guard(mutex);
+            results.emplace_back(dateTime, initialSeed, advances + initialAdvances);
+        }
+    }
+}
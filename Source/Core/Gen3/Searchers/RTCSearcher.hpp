@@ -37,6 +37,9 @@ private:
     std::vector<GameCubeRTCState> results;
     bool searching;
     std::mutex mutex;
+
+    void searchAdvances(u32 initialSeed, u32 targetSeed, u32 initialAdvances, u32 maxAdvances, u64 seconds);
+    void searchSeconds(u32 initialSeed, u32 targetSeed, u32 initialAdvances, u32 maxAdvances, u64 seconds);
 };
 
 #endif // RTCSEARCHER_HPP
@@ -109,9 +109,11 @@ std::vector<State> StationarySearcher3::searchMethod124(u8 hp, u8 atk, u8 def, u
         return states;
     }
 
-    auto seeds = cache.recoverLower16BitsIV(hp, atk, def, spa, spd, spe);
-    for (const u32 seed : seeds)
+    std::array<u32, RNGCache::maxSeeds> seeds;
+    u8 count = cache.recoverLower16BitsIV(hp, atk, def, spa, spd, spe, seeds);
+    for (u8 i = 0; i < count; i++)
     {
+        u32 seed = seeds[i];
         // Setup normal state
         PokeRNGR rng(seed);
         rng.advance(ivAdvance);
@@ -156,9 +158,11 @@ std::vector<State> StationarySearcher3::searchMethod1Reverse(u8 hp, u8 atk, u8 d
         return states;
     }
 
-    auto seeds = cache.recoverLower16BitsIV(hp, atk, def, spa, spd, spe);
-    for (const u32 seed : seeds)
+    std::array<u32, RNGCache::maxSeeds> seeds;
+    u8 count = cache.recoverLower16BitsIV(hp, atk, def, spa, spd, spe, seeds);
+    for (u8 i = 0; i < count; i++)
     {
+        u32 seed = seeds[i];
         // Setup normal state
         PokeRNGR rng(seed);
         rng.advance(ivAdvance);
@@ -36,6 +36,12 @@ void WildSearcher3::startSearch(const std::array<u8, 6> &min, const std::array<u
 {
     searching = true;
 
+    // Method H slots only depend on the slot call mod 100
+    for (u8 i = 0; i < 100; i++)
+    {
+        slots[i] = EncounterSlot::hSlot(i, encounter);
+    }
+
     for (u8 hp = min[0]; hp <= max[0]; hp++)
     {
         for (u8 atk = min[1]; atk <= max[1]; atk++)
@@ -95,9 +101,11 @@ std::vector<WildState> WildSearcher3::search(u8 hp, u8 atk, u8 def, u8 spa, u8 s
         return states;
     }
 
-    auto seeds = cache.recoverLower16BitsIV(hp, atk, def, spa, spd, spe);
-    for (const u32 val : seeds)
+    std::array<u32, RNGCache::maxSeeds> seeds;
+    u8 count = cache.recoverLower16BitsIV(hp, atk, def, spa, spd, spe, seeds);
+    for (u8 i = 0; i < count; i++)
     {
+        u32 val = seeds[i];
         // Setup normal state
         PokeRNGR rng(val);
         rng.advance(method == Method::MethodH2);
@@ -141,15 +149,7 @@ std::vector<WildState> WildSearcher3::search(u8 hp, u8 atk, u8 def, u8 spa, u8 s
                     if ((nextRNG % 25) == state.getNature())
                     {
                         state.setLead(Lead::None);
-                        PokeRNGR temp(testRNG.getSeed());
-                        u16 slot = temp.nextUShort();
-                        state.setSeed(temp.advance(2));
-                        state.setEncounterSlot(EncounterSlot::hSlot(slot, encounter));
-                        if (filter.compareEncounterSlot(state))
-                        {
-                            state.setLevel(encounterArea.calcLevel(state.getEncounterSlot(), testRNG.getSeed() >> 16));
-                            states.emplace_back(state);
-                        }
+                        addState(state, testRNG.getSeed(), 1, states);
                     }
                     break;
                 case Lead::Synchronize:
@@ -157,44 +157,20 @@ std::vector<WildState> WildSearcher3::search(u8 hp, u8 atk, u8 def, u8 spa, u8 s
                     if ((nextRNG & 1) == 0)
                     {
                         state.setLead(Lead::Synchronize);
-                        PokeRNGR temp(testRNG.getSeed());
-                        u16 slot = temp.nextUShort();
-                        state.setSeed(temp.advance(2));
-                        state.setEncounterSlot(EncounterSlot::hSlot(slot, encounter));
-                        if (filter.compareEncounterSlot(state))
-                        {
-                            state.setLevel(encounterArea.calcLevel(state.getEncounterSlot(), testRNG.getSeed() >> 16));
-                            states.emplace_back(state);
-                        }
+                        addState(state, testRNG.getSeed(), 1, states);
                     }
                     // Failed synch
                     else if ((nextRNG2 & 1) == 1 && (nextRNG % 25) == state.getNature())
                     {
                         state.setLead(Lead::Synchronize);
-                        PokeRNGR temp(testRNG.getSeed());
-                        u16 slot = temp.advance(2) >> 16;
-                        state.setSeed(temp.advance(2));
-                        state.setEncounterSlot(EncounterSlot::hSlot(slot, encounter));
-                        if (filter.compareEncounterSlot(state))
-                        {
-                            state.setLevel(encounterArea.calcLevel(state.getEncounterSlot(), testRNG.getSeed() >> 16));
-                            states.emplace_back(state);
-                        }
+                        addState(state, testRNG.getSeed(), 2, states);
                     }
                     break;
                 case Lead::CuteCharm:
                     if ((nextRNG % 25) == state.getNature() && (nextRNG2 % 3) > 0)
                     {
                         state.setLead(Lead::CuteCharm);
-                        PokeRNGR temp(testRNG.getSeed());
-                        u16 slot = temp.advance(2) >> 16;
-                        state.setSeed(temp.advance(2));
-                        state.setEncounterSlot(EncounterSlot::hSlot(slot, encounter));
-                        if (filter.compareEncounterSlot(state))
-                        {
-                            state.setLevel(encounterArea.calcLevel(state.getEncounterSlot(), testRNG.getSeed() >> 16));
-                            states.emplace_back(state);
-                        }
+                        addState(state, testRNG.getSeed(), 2, states);
                     }
                     break;
                 case Lead::Search:
@@ -203,33 +179,15 @@ std::vector<WildState> WildSearcher3::search(u8 hp, u8 atk, u8 def, u8 spa, u8 s
                     if ((nextRNG % 25) == state.getNature())
                     {
                         state.setLead(Lead::None);
-                        PokeRNGR temp(testRNG.getSeed());
-                        u16 slot = temp.nextUShort();
-                        state.setSeed(temp.advance(2));
-                        state.setEncounterSlot(EncounterSlot::hSlot(slot, encounter));
-                        if (filter.compareEncounterSlot(state))
-                        {
-                            state.setLevel(encounterArea.calcLevel(state.getEncounterSlot(), testRNG.getSeed() >> 16));
-                            states.emplace_back(state);
-                        }
+                        addState(state, testRNG.getSeed(), 1, states);
 
-                        temp.setSeed(testRNG.getSeed());
-                        slot = temp.advance(2) >> 16;
-                        state.setSeed(temp.advance(2));
-                        state.setEncounterSlot(EncounterSlot::hSlot(slot, encounter));
-                        if (filter.compareEncounterSlot(state))
+                        // Failed synch and Cute Charm share the same slot call
+                        bool synch = (nextRNG2 & 1) == 1;
+                        bool cuteCharm = (nextRNG2 % 3) > 0;
+                        if (synch || cuteCharm)
                         {
-                            state.setLevel(encounterArea.calcLevel(state.getEncounterSlot(), testRNG.getSeed() >> 16));
-
-                            // Failed synch
-                            if ((nextRNG2 & 1) == 1 && (nextRNG % 25) == state.getNature())
-                            {
-                                state.setLead(Lead::Synchronize);
-                                states.emplace_back(state);
-                            }
-
-                            // Cute Charm
-                            if ((nextRNG2 % 3) > 0)
+                            state.setLead(synch ? Lead::Synchronize : Lead::CuteCharm);
+                            if (addState(state, testRNG.getSeed(), 2, states) && synch && cuteCharm)
                             {
                                 state.setLead(Lead::CuteCharm);
                                 states.emplace_back(state);
@@ -240,15 +198,7 @@ std::vector<WildState> WildSearcher3::search(u8 hp, u8 atk, u8 def, u8 spa, u8 s
                     else if ((nextRNG & 1) == 0)
                     {
                         state.setLead(Lead::Synchronize);
-                        PokeRNGR temp(testRNG.getSeed());
-                        u16 slot = temp.nextUShort();
-                        state.setSeed(temp.advance(2));
-                        state.setEncounterSlot(EncounterSlot::hSlot(slot, encounter));
-                        if (filter.compareEncounterSlot(state))
-                        {
-                            state.setLevel(encounterArea.calcLevel(state.getEncounterSlot(), testRNG.getSeed() >> 16));
-                            states.emplace_back(state);
-                        }
+                        addState(state, testRNG.getSeed(), 1, states);
                     }
                     break;
                 }
@@ -268,21 +218,38 @@ std::vector<WildState> WildSearcher3::search(u8 hp, u8 atk, u8 def, u8 spa, u8 s
         // 2880 means FRLG which is not dependent on origin seed for encounter check
         if (rate != 2880)
         {
-            for (size_t i = 0; i < states.size();)
+            size_t size = 0;
+            for (auto &state : states)
             {
-                u16 check = PokeRNG(states[i].getSeed()).nextUShort();
-                if ((check % 2880) >= rate)
-                {
-                    states.erase(states.begin() + i);
-                }
-                else
+                u16 check = PokeRNG(state.getSeed()).nextUShort();
+                if ((check % 2880) < rate)
                 {
-                    states[i].setSeed(PokeRNGR(states[i].getSeed()).next());
-                    i++;
+                    state.setSeed(PokeRNGR(state.getSeed()).next());
+                    states[size++] = state;
                 }
             }
+            states.resize(size);
         }
     }
 
     return states;
 }
+
+// Slot call is either directly before the level call or separated from it by a lead call
+// Origin seed is only calculated for slots that pass the filter
+bool WildSearcher3::addState(WildState &state, u32 seed, u8 calls, std::vector<WildState> &states) const
+{
+    PokeRNGR rng(seed);
+    u16 slot = rng.advance(calls) >> 16;
+
+    state.setEncounterSlot(slots[slot % 100]);
+    if (!filter.compareEncounterSlot(state))
+    {
+        return false;
+    }
+
+    state.setSeed(rng.advance(2));
+    state.setLevel(encounterArea.calcLevel(state.getEncounterSlot(), seed >> 16));
+    states.emplace_back(state);
+    return true;
+}
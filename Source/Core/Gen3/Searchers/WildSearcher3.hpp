@@ -24,6 +24,7 @@
 #include <Core/Parents/Searchers/WildSearcher.hpp>
 #include <Core/Parents/States/WildState.hpp>
 #include <Core/RNG/RNGCache.hpp>
+#include <array>
 #include <mutex>
 
 class WildSearcher3 : public WildSearcher
@@ -40,6 +41,7 @@ public:
 private:
     RNGCache cache;
     EncounterArea3 encounterArea;
+    std::array<u8, 100> slots;
 
     bool searching;
     int progress;
@@ -47,6 +49,7 @@ private:
     std::mutex mutex;
 
     std::vector<WildState> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const;
+    bool addState(WildState &state, u32 seed, u8 calls, std::vector<WildState> &states) const;
 };
 
 #endif // WILDSEARCHER3_HPP
@@ -18,12 +18,23 @@
  */
 
 #include "ShadowLock.hpp"
+#include <Core/Enum/ShadowType.hpp>
 #include <Core/Gen3/ShadowTeam.hpp>
 
 /* Each non-shadow before a shadow has to match
  * a specific gender/nature and these preset
  * values directly impact what spreads are available */
 
+// Two advances of each direction folded into one multiply so rerolls only wait on a single multiply per PID
+constexpr u32 backwardMult = 0xB9B33155;
+constexpr u32 backwardAdd = 0xA170F641;
+constexpr u32 backwardMult2 = backwardMult * backwardMult;
+constexpr u32 backwardAdd2 = backwardAdd * (backwardMult + 1);
+constexpr u32 forwardMult = 0x343FD;
+constexpr u32 forwardAdd = 0x269EC3;
+constexpr u32 forwardMult2 = forwardMult * forwardMult;
+constexpr u32 forwardAdd2 = forwardAdd * (forwardMult + 1);
+
 inline bool isShiny(u32 pid, u16 tsv)
 {
     return ((pid >> 16) ^ (pid & 0xffff) ^ tsv) < 8;
@@ -36,11 +47,39 @@ inline u32 getPIDBackward(XDRNGR &rng)
     return pid;
 }
 
-inline u32 getPIDForward(XDRNG &rng)
+inline u32 getPIDBackward(u32 &seed)
 {
-    u32 pid = rng.next() & 0xffff0000;
-    pid |= rng.nextUShort();
-    return pid;
+    u32 low = seed * backwardMult + backwardAdd;
+    seed = seed * backwardMult2 + backwardAdd2;
+    return (low >> 16) | (seed & 0xffff0000);
+}
+
+inline u32 getPIDForward(u32 &seed)
+{
+    u32 high = seed * forwardMult + forwardAdd;
+    seed = seed * forwardMult2 + forwardAdd2;
+    return (high & 0xffff0000) | (seed >> 16);
+}
+
+// Backward advances are expressed as forward advances modulo 2^32 since the RNG has a full period
+inline void computeJump(u32 advances, u32 &mult, u32 &add)
+{
+    mult = 1;
+    add = 0;
+
+    u32 jumpMult = forwardMult;
+    u32 jumpAdd = forwardAdd;
+    for (; advances; advances >>= 1)
+    {
+        if (advances & 1)
+        {
+            mult *= jumpMult;
+            add = add * jumpMult + jumpAdd;
+        }
+
+        jumpAdd *= jumpMult + 1;
+        jumpMult *= jumpMult;
+    }
 }
 
 ShadowLock::ShadowLock(u8 num, Method version)
@@ -48,12 +87,12 @@ ShadowLock::ShadowLock(u8 num, Method version)
     switchLock(num, version);
 }
 
-ShadowType ShadowLock::getType()
+ShadowType ShadowLock::getType() const
 {
     return type;
 }
 
-bool ShadowLock::singleNL(u32 seed, u16 tsv)
+bool ShadowLock::singleNL(u32 seed, u16 tsv) const
 {
     XDRNGR backward(seed);
     backward.advance(1);
@@ -67,7 +106,7 @@ bool ShadowLock::singleNL(u32 seed, u16 tsv)
 
 // Working backwards it is hard to know what PID would get rerolled from shiny lock
 // Only check shiny lock working forwards which should be good enough
-bool ShadowLock::firstShadowNormal(u32 seed, u16 tsv)
+bool ShadowLock::firstShadowNormal(u32 seed, u16 tsv) const
 {
     XDRNGR backward(seed);
     backward.advance(1);
@@ -75,52 +114,17 @@ bool ShadowLock::firstShadowNormal(u32 seed, u16 tsv)
     // Grab PID from first non-shadow going backwards
     // If it doesn't match spread fails
     u32 pidOriginal = getPIDBackward(backward);
-    auto backwardLock = locks.cbegin();
-    if (!backwardLock->compare(pidOriginal))
+    if (!locks.front().compare(pidOriginal))
     {
         return false;
     }
 
-    u32 pid;
-    for (backwardLock++; backwardLock != locks.cend(); backwardLock++)
-    {
-        backward.advance(5);
-
-        // If lock is a shadow assume PID is already set
-        if (!backwardLock->getFree())
-        {
-            do
-            {
-                pid = getPIDBackward(backward);
-            } while (!backwardLock->compare(pid));
-        }
-    }
-
-    XDRNG forward(backward.getSeed());
-    forward.advance(1);
-
-    auto forwardLock = locks.crbegin();
-    for (forwardLock++; forwardLock != locks.crend(); forwardLock++)
-    {
-        forward.advance(5);
-
-        // If lock is a shadow assume PID is already set
-        if (!forwardLock->getFree())
-        {
-            do
-            {
-                pid = getPIDForward(forward);
-            } while (!forwardLock->compare(pid) || isShiny(pid, tsv));
-        }
-    }
-
-    // Check if we end on the same PID as first non-shadow going backwards
-    return pidOriginal == pid;
+    return validateLocks<true>(backward.getSeed(), pidOriginal, tsv);
 }
 
 // Working backwards it is hard to know what PID would get rerolled from shiny lock
 // Only check shiny lock working forwards which should be good enough
-bool ShadowLock::firstShadowSet(u32 seed, u16 tsv)
+bool ShadowLock::firstShadowSet(u32 seed, u16 tsv) const
 {
     XDRNGR backward(seed);
     backward.advance(6);
@@ -128,52 +132,17 @@ bool ShadowLock::firstShadowSet(u32 seed, u16 tsv)
     // Grab PID from first non-shadow going backwards
     // If it doesn't match spread fails
     u32 pidOriginal = getPIDBackward(backward);
-    auto backwardLock = locks.cbegin();
-    if (!backwardLock->compare(pidOriginal))
+    if (!locks.front().compare(pidOriginal))
     {
         return false;
     }
 
-    u32 pid;
-    for (backwardLock++; backwardLock != locks.cend(); backwardLock++)
-    {
-        backward.advance(5);
-
-        // If lock is a shadow assume PID is already set
-        if (!backwardLock->getFree())
-        {
-            do
-            {
-                pid = getPIDBackward(backward);
-            } while (!backwardLock->compare(pid));
-        }
-    }
-
-    XDRNG forward(backward.getSeed());
-    forward.advance(1);
-
-    auto forwardLock = locks.crbegin();
-    for (forwardLock++; forwardLock != locks.crend(); forwardLock++)
-    {
-        forward.advance(5);
-
-        // If lock is a shadow assume PID is already set
-        if (!forwardLock->getFree())
-        {
-            do
-            {
-                pid = getPIDForward(forward);
-            } while (!forwardLock->compare(pid) || isShiny(pid, tsv));
-        }
-    }
-
-    // Check if we end on the same PID as first non-shadow going backwards
-    return pidOriginal == pid;
+    return validateLocks<true>(backward.getSeed(), pidOriginal, tsv);
 }
 
 // Working backwards it is hard to know what PID would get rerolled from shiny lock
 // Only check shiny lock working forwards which should be good enough
-bool ShadowLock::firstShadowUnset(u32 seed, u16 tsv)
+bool ShadowLock::firstShadowUnset(u32 seed, u16 tsv) const
 {
     XDRNGR backward(seed);
     backward.advance(3);
@@ -192,50 +161,15 @@ bool ShadowLock::firstShadowUnset(u32 seed, u16 tsv)
     // Grab PID from first non-shadow going backwards
     // If it doesn't match spread fails
     u32 pidOriginal = getPIDBackward(backward);
-    auto backwardLock = locks.cbegin();
-    if (!backwardLock->compare(pidOriginal))
+    if (!locks.front().compare(pidOriginal))
     {
         return false;
     }
 
-    u32 pid;
-    for (backwardLock++; backwardLock != locks.cend(); backwardLock++)
-    {
-        backward.advance(5);
-
-        // If lock is a shadow assume PID is already set
-        if (!backwardLock->getFree())
-        {
-            do
-            {
-                pid = getPIDBackward(backward);
-            } while (!backwardLock->compare(pid));
-        }
-    }
-
-    XDRNG forward(backward.getSeed());
-    forward.advance(1);
-
-    auto forwardLock = locks.crbegin();
-    for (forwardLock++; forwardLock != locks.crend(); forwardLock++)
-    {
-        forward.advance(5);
-
-        // If lock is a shadow assume PID is already set
-        if (!forwardLock->getFree())
-        {
-            do
-            {
-                pid = getPIDForward(forward);
-            } while (!forwardLock->compare(pid) || isShiny(pid, tsv));
-        }
-    }
-
-    // Check if we end on the same PID as first non-shadow going backwards
-    return pidOriginal == pid;
+    return validateLocks<true>(backward.getSeed(), pidOriginal, tsv);
 }
 
-bool ShadowLock::salamenceSet(u32 seed, u16 tsv)
+bool ShadowLock::salamenceSet(u32 seed, u16 tsv) const
 {
     XDRNGR backward(seed);
     backward.advance(6);
@@ -246,7 +180,7 @@ bool ShadowLock::salamenceSet(u32 seed, u16 tsv)
     return locks.front().compare(pid) && !isShiny(pid, tsv);
 }
 
-bool ShadowLock::salamenceUnset(u32 seed, u16 tsv)
+bool ShadowLock::salamenceUnset(u32 seed, u16 tsv) const
 {
     XDRNGR backward(seed);
     backward.advance(3);
@@ -272,7 +206,7 @@ bool ShadowLock::salamenceUnset(u32 seed, u16 tsv)
 // The following is technically shiny locked by the trainer TID/SID
 // It is extremely hard to know what that value is working from only IVs
 // Assume that the shiny lock won't play a significant factor
-bool ShadowLock::coloShadow(u32 seed)
+bool ShadowLock::coloShadow(u32 seed) const
 {
     XDRNGR backward(seed);
     backward.advance(1);
@@ -280,101 +214,94 @@ bool ShadowLock::coloShadow(u32 seed)
     // Grab PID from first non-shadow going backwards
     // If it doesn't match spread fails
     u32 pidOriginal = getPIDBackward(backward);
-    auto backwardLock = locks.cbegin();
-    if (!backwardLock->compare(pidOriginal))
+    if (!locks.front().compare(pidOriginal))
     {
         return false;
     }
 
-    u32 pid;
-    for (backwardLock++; backwardLock != locks.cend(); backwardLock++)
-    {
-        backward.advance(5);
-
-        // If lock is a shadow assume PID is already set
-        if (!backwardLock->getFree())
-        {
-            do
-            {
-                pid = getPIDBackward(backward);
-            } while (!backwardLock->compare(pid));
-        }
-    }
-
-    XDRNG forward(backward.getSeed());
-    forward.advance(1);
-
-    auto forwardLock = locks.crbegin();
-    for (forwardLock++; forwardLock != locks.crend(); forwardLock++)
-    {
-        forward.advance(5);
-
-        // If lock is a shadow assume PID is already set
-        if (!forwardLock->getFree())
-        {
-            do
-            {
-                pid = getPIDForward(forward);
-            } while (!forwardLock->compare(pid));
-        }
-    }
-
-    // Check if we end on the same PID as first non-shadow going backwards
-    return pidOriginal == pid;
+    return validateLocks<false>(backward.getSeed(), pidOriginal, 0);
 }
 
 // The following is technically shiny locked by the trainer TID/SID
 // It is extremely hard to know what that value is working from only IVs
 // Assume that the shiny lock won't play a significant factor
-bool ShadowLock::ereader(u32 seed, u32 readerPID)
+bool ShadowLock::ereader(u32 seed, u32 readerPID) const
 {
     // Check if PID is even valid for E-Reader
     // E-Reader have set nature/gender
-    auto backwardLock = locks.cbegin();
-    if (!backwardLock->compare(readerPID))
+    if (!locks.front().compare(readerPID))
     {
         return false;
     }
 
-    XDRNGR backward(seed);
-    backward.advance(1);
+    // The jump tables for E-Reader skip the first 5 advances themselves
+    return validateLocks<false>(XDRNGR(seed).next(), readerPID, 0);
+}
 
-    u32 pid;
-    for (backwardLock++; backwardLock != locks.cend(); backwardLock++)
+void ShadowLock::switchLock(u8 lockNum, Method version)
+{
+    auto team = ShadowTeam::loadShadowTeams(version)[lockNum];
+
+    locks = team.getLocks();
+    type = team.getType();
+
+    backwardLocks.clear();
+    forwardLocks.clear();
+
+    // Every lock after the first costs 5 advances going backwards and a reroll if it is not free
+    // Runs of free locks are collapsed into the jump of the next non-free lock
+    // E-Reader teams start rerolling immediately after the shadow
+    u32 advances = type == ShadowType::EReader ? 5 : 0;
+    for (size_t i = 1; i < locks.size(); i++)
     {
-        if (backwardLock != locks.cbegin() + 1)
+        advances -= 5;
+        if (!locks[i].getFree())
         {
-            backward.advance(5);
+            LockJump jump { locks[i], 0, 0 };
+            computeJump(advances, jump.mult, jump.add);
+            backwardLocks.emplace_back(jump);
+            advances = 0;
         }
+    }
 
-        do
+    // Going forward starts 1 advance ahead of where the backward walk ended
+    // The first lock is never free so the last jump always lands on it
+    advances++;
+    for (size_t i = locks.size(); i-- > 1;)
+    {
+        advances += 5;
+        if (!locks[i - 1].getFree())
         {
-            pid = getPIDBackward(backward);
-        } while (!backwardLock->compare(pid));
+            LockJump jump { locks[i - 1], 0, 0 };
+            computeJump(advances, jump.mult, jump.add);
+            forwardLocks.emplace_back(jump);
+            advances = 0;
+        }
     }
+}
 
-    XDRNG forward(backward.getSeed());
-    forward.advance(1);
-
-    auto forwardLock = locks.crbegin();
-    for (forwardLock++; forwardLock != locks.crend(); forwardLock++)
+template <bool shinyLock>
+bool ShadowLock::validateLocks(u32 seed, u32 pidOriginal, u16 tsv) const
+{
+    u32 pid;
+    for (const auto &jump : backwardLocks)
     {
-        forward.advance(5);
-
+        seed = seed * jump.mult + jump.add;
         do
         {
-            pid = getPIDForward(forward);
-        } while (!forwardLock->compare(pid));
+            pid = getPIDBackward(seed);
+        } while (!jump.lock.compare(pid));
     }
 
-    // Checks if PID matches original
-    return pid == readerPID;
-}
-
-void ShadowLock::switchLock(u8 lockNum, Method version)
-{
-    auto team = ShadowTeam::loadShadowTeams(version)[lockNum];
+    for (const auto &jump : forwardLocks)
+    {
+        seed = seed * jump.mult + jump.add;
+        do
+        {
+            pid = getPIDForward(seed);
+        } while (!jump.lock.compare(pid) || (shinyLock && isShiny(pid, tsv)));
+    }
 
-    locks = team.getLocks();
-    type = team.getType();
+    // Check if we end on the same PID as first non-shadow going backwards
+    return pidOriginal == pid;
 }
@@ -32,20 +32,33 @@ class ShadowLock
 public:
     ShadowLock() = default;
     ShadowLock(u8 num, Method version);
-    ShadowType getType();
-    bool singleNL(u32 seed, u16 tsv);
-    bool firstShadowNormal(u32 seed, u16 tsv);
-    bool firstShadowSet(u32 seed, u16 tsv);
-    bool firstShadowUnset(u32 seed, u16 tsv);
-    bool salamenceSet(u32 seed, u16 tsv);
-    bool salamenceUnset(u32 seed, u16 tsv);
-    bool coloShadow(u32 seed);
-    bool ereader(u32 seed, u32 readerPID);
+    ShadowType getType() const;
+    bool singleNL(u32 seed, u16 tsv) const;
+    bool firstShadowNormal(u32 seed, u16 tsv) const;
+    bool firstShadowSet(u32 seed, u16 tsv) const;
+    bool firstShadowUnset(u32 seed, u16 tsv) const;
+    bool salamenceSet(u32 seed, u16 tsv) const;
+    bool salamenceUnset(u32 seed, u16 tsv) const;
+    bool coloShadow(u32 seed) const;
+    bool ereader(u32 seed, u32 readerPID) const;
     void switchLock(u8 lockNum, Method version);
 
 private:
+    // Non-free lock along with the single jump that reaches it from the previous non-free lock
+    struct LockJump
+    {
+        LockInfo lock;
+        u32 mult;
+        u32 add;
+    };
+
     std::vector<LockInfo> locks;
+    std::vector<LockJump> backwardLocks;
+    std::vector<LockJump> forwardLocks;
     ShadowType type;
+
+    template <bool shinyLock>
+    bool validateLocks(u32 seed, u32 pidOriginal, u16 tsv) const;
 };
 
 #endif // SHADOWLOCK_HPP
@@ -20,24 +20,25 @@
 #include "ShadowTeam.hpp"
 #include <Core/Enum/Method.hpp>
 #include <Core/Enum/ShadowType.hpp>
-#include <Core/Resources/Encounters.hpp>
+#include <Core/Util/ResourceLoader.hpp>
 
 std::vector<ShadowTeam> ShadowTeam::loadShadowTeams(Method version)
 {
-    const u8 *data;
-    size_t size;
+    std::string name;
 
     if (version == Method::XD)
     {
-        data = gales.data();
-        size = gales.size();
+        name = "gales";
     }
     else
     {
-        data = colo.data();
-        size = colo.size();
+        name = "colo";
     }
 
+    const std::vector<u8> &resource = ResourceLoader::getResource(name);
+    const u8 *data = resource.data();
+    size_t size = resource.size();
+
     std::vector<ShadowTeam> teams;
 
     for (size_t i = 0; i < size;)
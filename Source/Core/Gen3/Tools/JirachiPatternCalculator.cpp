@@ -19,14 +19,14 @@
 
 #include "JirachiPatternCalculator.hpp"
 #include <Core/RNG/LCRNG.hpp>
-#include <iterator>
-#include <sstream>
+#include <algorithm>
+#include <future>
 
 namespace JirachiPatternCalculator
 {
     namespace
     {
-        u8 getTarget(u8 index, const std::vector<u16> &data)
+        u8 getTarget(u8 index, const std::array<u16, 31> &data)
         {
             /*
              *  thresh = [ .25,.33 ]
@@ -70,15 +70,36 @@ namespace JirachiPatternCalculator
     {
         std::vector<std::string> patterns;
 
+        u64 compact[3];
+        u8 count = getPatterns(seed, compact);
+        for (u8 i = 0; i < count; i++)
+        {
+            patterns.emplace_back(getPatternString(compact[i]));
+        }
+
+        return patterns;
+    }
+
+    u8 getPatterns(u32 seed, u64 *patterns)
+    {
         XDRNGR rng(seed);
-        std::vector<u16> data;
-        data.emplace_back(seed >> 16);
+        std::array<u16, 31> data;
+        data[0] = seed >> 16;
 
-        for (u8 i = 0; i < 30; i++)
+        for (u8 i = 1; i < 31; i++)
         {
-            data.emplace_back(rng.nextUShort());
+            data[i] = rng.nextUShort();
         }
 
+        // Patterns are packed with 2 bits per menu value, data[1] in the lowest bits, and the target index in the top 4 bits
+        u64 menu = 0;
+        for (u8 i = 30; i > 0; i--)
+        {
+            menu = (menu << 2) | (data[i] >> 14);
+        }
+
+        u8 count = 0;
+
         // Loop through 3 possible pattern cases
         for (u8 i = 0; i < 3; i++)
         {
@@ -110,17 +131,7 @@ namespace JirachiPatternCalculator
                         // Spread valid
                         if ((mask & 14) == 14)
                         {
-                            std::vector<std::string> pattern;
-                            for (size_t j = data.size() - 1; j > 0; j--)
-                            {
-                                pattern.emplace_back(std::to_string(data[j] >> 14));
-                            }
-                            pattern[pattern.size() - index] = "T:" + pattern[pattern.size() - index];
-
-                            std::stringstream stream;
-                            std::copy(pattern.begin(), pattern.end(), std::ostream_iterator<std::string>(stream, " | "));
-                            patterns.emplace_back(stream.str());
-
+                            patterns[count++] = menu | (static_cast<u64>(index) << 60);
                             break;
                         }
                     }
@@ -128,6 +139,108 @@ namespace JirachiPatternCalculator
             }
         }
 
+        return count;
+    }
+
+    std::vector<std::pair<u32, u64>> getPatterns(const std::vector<u32> &seeds, int threads)
+    {
+        if (threads < 1)
+        {
+            threads = 1;
+        }
+        else if (static_cast<size_t>(threads) > seeds.size())
+        {
+            threads = std::max(static_cast<int>(seeds.size()), 1);
+        }
+
+        std::vector<std::future<std::vector<std::pair<u32, u64>>>> threadContainer;
+
+        size_t split = seeds.size() / threads;
+        size_t start = 0;
+        for (int i = 0; i < threads; i++)
+        {
+            size_t end = i == threads - 1 ? seeds.size() : start + split;
+            threadContainer.emplace_back(std::async(std::launch::async, [=, &seeds] {
+                std::vector<std::pair<u32, u64>> patterns;
+                for (size_t j = start; j < end; j++)
+                {
+                    u64 compact[3];
+                    u8 count = getPatterns(seeds[j], compact);
+                    for (u8 k = 0; k < count; k++)
+                    {
+                        patterns.emplace_back(seeds[j], compact[k]);
+                    }
+                }
+                return patterns;
+            }));
+            start += split;
+        }
+
+        std::vector<std::pair<u32, u64>> patterns;
+        for (int i = 0; i < threads; i++)
+        {
+            auto shard = threadContainer[i].get();
+            patterns.insert(patterns.end(), shard.begin(), shard.end());
+        }
+
         return patterns;
     }
+
+    u64 getPattern(const std::array<u8, 30> &menu, u8 index)
+    {
+        // Menu values are in display order, the oldest value first
+        // Index is the advance the target lands on (6, 7 or 8), not the target value
+        u64 pattern = static_cast<u64>(index) << 60;
+        for (u8 i = 0; i < 30; i++)
+        {
+            pattern |= static_cast<u64>(menu[i] & 3) << (2 * (29 - i));
+        }
+        return pattern;
+    }
+
+    std::string getPatternString(u64 pattern)
+    {
+        u8 index = pattern >> 60;
+
+        std::string string;
+        for (u8 i = 30; i > 0; i--)
+        {
+            if (i == index)
+            {
+                string += "T:";
+            }
+            string += std::to_string((pattern >> (2 * (i - 1))) & 3);
+            string += " | ";
+        }
+
+        return string;
+    }
+
+    std::vector<std::pair<u64, u32>> getPatternIndex(const std::vector<u32> &seeds, int threads)
+    {
+        std::vector<std::pair<u64, u32>> index;
+
+        auto patterns = getPatterns(seeds, threads);
+        index.reserve(patterns.size());
+        for (const auto &[seed, pattern] : patterns)
+        {
+            index.emplace_back(pattern, seed);
+        }
+
+        std::sort(index.begin(), index.end());
+        return index;
+    }
+
+    std::vector<u32> getSeeds(const std::vector<std::pair<u64, u32>> &index, u64 pattern)
+    {
+        std::vector<u32> seeds;
+
+        auto first = std::lower_bound(index.begin(), index.end(), std::make_pair(pattern, 0U));
+        for (auto it = first; it != index.end() && it->first == pattern; ++it)
+        {
+            seeds.emplace_back(it->second);
+        }
+
+        return seeds;
+    }
 }
@@ -21,12 +21,19 @@
 #define JIRACHIPATTERNCALCULATOR_HPP
 
 #include <Core/Util/Global.hpp>
+#include <array>
 #include <string>
 #include <vector>
 
 namespace JirachiPatternCalculator
 {
     std::vector<std::string> getPatterns(u32 seed);
+    u8 getPatterns(u32 seed, u64 *patterns);
+    std::vector<std::pair<u32, u64>> getPatterns(const std::vector<u32> &seeds, int threads);
+    u64 getPattern(const std::array<u8, 30> &menu, u8 index);
+    std::string getPatternString(u64 pattern);
+    std::vector<std::pair<u64, u32>> getPatternIndex(const std::vector<u32> &seeds, int threads);
+    std::vector<u32> getSeeds(const std::vector<std::pair<u64, u32>> &index, u64 pattern);
 }
 
 #endif // JIRACHIPATTERNCALCULATOR_HPP
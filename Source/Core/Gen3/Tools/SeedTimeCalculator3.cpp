@@ -18,37 +18,117 @@
  */
 
 #include "SeedTimeCalculator3.hpp"
+#include <algorithm>
+#include <array>
+#include <tuple>
 
-namespace SeedTimeCalculator3
+namespace
 {
-    std::vector<SeedTimeState3> calculateTimes(u32 seed, u32 advance, u16 year)
+    // Clock value contributed by the hour and minute, at most 960 * 2 + 60 * 3 + 16 * 5 + 9
+    constexpr u16 maxTimeValue = 2189;
+
+    struct TimeIndex
     {
-        std::vector<SeedTimeState3> states;
+        std::array<u16, maxTimeValue + 2> offsets;
+        std::array<std::pair<u8, u8>, 1440> times;
+    };
 
-        constexpr Date start;
-        Date date(year, 1, 1);
-        Date end(year, 12, 31);
+    u16 timeValue(u8 hour, u8 minute)
+    {
+        return 960 * (hour / 10) + 60 * (hour % 10) + 16 * (minute / 10) + (minute % 10);
+    }
 
-        for (; date <= end; date = date.addDays(1))
-        {
-            // The if statement considering the year is to handle a bug the game has
-            // If the year is greater then 2000 it does not count the days in that year
-            u16 days = start.daysTo(date) - (year > 2000 ? 366 : 0) + 1;
+    // Inverse of timeValue, the times with value v are times[offsets[v]] to times[offsets[v + 1]]
+    const TimeIndex &getTimeIndex()
+    {
+        static const TimeIndex index = [] {
+            TimeIndex index {};
+            for (u8 hour = 0; hour < 24; hour++)
+            {
+                for (u8 minute = 0; minute < 60; minute++)
+                {
+                    index.offsets[timeValue(hour, minute) + 1]++;
+                }
+            }
+
+            for (u16 v = 0; v <= maxTimeValue; v++)
+            {
+                index.offsets[v + 1] += index.offsets[v];
+            }
 
+            std::array<u16, maxTimeValue + 1> positions;
+            std::copy(index.offsets.begin(), index.offsets.end() - 1, positions.begin());
             for (u8 hour = 0; hour < 24; hour++)
             {
                 for (u8 minute = 0; minute < 60; minute++)
                 {
-                    u32 v = 1440 * days + 960 * (hour / 10) + 60 * (hour % 10) + 16 * (minute / 10) + (minute % 10);
-                    v = (v >> 16) ^ (v & 0xffff);
-                    if (v == seed)
-                    {
-                        states.emplace_back(DateTime(date, Time(hour, minute, 0)), advance);
-                    }
+                    index.times[positions[timeValue(hour, minute)]++] = std::make_pair(hour, minute);
+                }
+            }
+
+            return index;
+        }();
+        return index;
+    }
+
+    void calculateYear(u16 seed, u32 advance, u16 year, std::vector<SeedTimeState3> &states)
+    {
+        const TimeIndex &index = getTimeIndex();
+
+        constexpr Date start;
+
+        // The offset considering the year is to handle a bug the game has
+        // If the year is greater then 2000 it does not count the days in that year
+        int offset = year > 2000 ? 366 : 0;
+        u32 first = static_cast<u16>(start.daysTo(Date(year, 1, 1)) - offset + 1);
+        u32 last = static_cast<u16>(start.daysTo(Date(year, 12, 31)) - offset + 1);
+
+        // The seed is the upper and lower half of the clock value xored together
+        // Each possible upper half fixes the clock value, which splits into days and a time value
+        std::vector<std::tuple<u32, u8, u8>> times;
+        for (u32 high = (1440 * first) >> 16; high <= (1440 * last + maxTimeValue) >> 16; high++)
+        {
+            u32 v = (high << 16) | (seed ^ high);
+            u32 dayMin = v > maxTimeValue ? std::max(first, (v - maxTimeValue + 1439) / 1440) : first;
+            u32 dayMax = std::min(last, v / 1440);
+            for (u32 days = dayMin; days <= dayMax; days++)
+            {
+                u16 value = v - 1440 * days;
+                for (u16 i = index.offsets[value]; i < index.offsets[value + 1]; i++)
+                {
+                    times.emplace_back(days, index.times[i].first, index.times[i].second);
                 }
             }
         }
 
+        std::sort(times.begin(), times.end());
+        for (const auto &[days, hour, minute] : times)
+        {
+            states.emplace_back(DateTime(start.addDays(days + offset - 1), Time(hour, minute, 0)), advance);
+        }
+    }
+}
+
+namespace SeedTimeCalculator3
+{
+    std::vector<SeedTimeState3> calculateTimes(u32 seed, u32 advance, u16 year)
+    {
+        return calculateTimes(seed, advance, year, year);
+    }
+
+    std::vector<SeedTimeState3> calculateTimes(u32 seed, u32 advance, u16 startYear, u16 endYear)
+    {
+        std::vector<SeedTimeState3> states;
+        if (seed > 0xffff)
+        {
+            return states;
+        }
+
+        for (u32 year = startYear; year <= endYear; year++)
+        {
+            calculateYear(seed, advance, year, states);
+        }
+
         return states;
     }
 }
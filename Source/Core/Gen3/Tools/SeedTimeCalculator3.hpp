@@ -26,6 +26,7 @@
 namespace SeedTimeCalculator3
 {
     std::vector<SeedTimeState3> calculateTimes(u32 seed, u32 advance, u16 year);
+    std::vector<SeedTimeState3> calculateTimes(u32 seed, u32 advance, u16 startYear, u16 endYear);
     u16 calculateOriginSeed(u32 seed);
 }
 
@@ -24,69 +24,65 @@
 #include <Core/Gen4/Profile4.hpp>
 #include <Core/Parents/PersonalLoader.hpp>
 #include <Core/Parents/Slot.hpp>
-#include <Core/Resources/Encounters.hpp>
+#include <Core/Util/ResourceLoader.hpp>
 #include <algorithm>
-#include <cstring>
 #include <iterator>
+#include <map>
+#include <mutex>
 
 namespace Encounters4
 {
     namespace
     {
-        std::vector<std::vector<u8>> getData(Game game)
+        std::vector<const u8 *> getData(Game game)
         {
-            const u8 *data;
-            size_t size;
+            std::string name;
             int offset;
 
             if (game == Game::Diamond)
             {
-                data = diamond.data();
-                size = diamond.size();
+                name = "diamond";
                 offset = 159;
             }
             else if (game == Game::Pearl)
             {
-                data = pearl.data();
-                size = pearl.size();
+                name = "pearl";
                 offset = 159;
             }
             else if (game == Game::Platinum)
             {
-                data = platinum.data();
-                size = platinum.size();
+                name = "platinum";
                 offset = 159;
             }
             else if (game == Game::HeartGold)
             {
-                data = heartgold.data();
-                size = heartgold.size();
+                name = "heartgold";
                 offset = 192;
             }
             else
             {
-                data = soulsilver.data();
-                size = soulsilver.size();
+                name = "soulsilver";
                 offset = 192;
             }
 
-            std::vector<std::vector<u8>> encounters;
-            for (size_t i = 0; i < size; i += offset)
+            // Records are read in place from the decompressed resource
+            const std::vector<u8> &resource = ResourceLoader::getResource(name);
+
+            std::vector<const u8 *> encounters;
+            for (size_t i = 0; i < resource.size(); i += offset)
             {
-                std::vector<u8> entry(offset);
-                std::memcpy(entry.data(), data + i, offset);
-                encounters.emplace_back(entry);
+                encounters.emplace_back(resource.data() + i);
             }
 
             return encounters;
         }
 
-        u16 getValue(const std::vector<u8> &data, int offset)
+        u16 getValue(const u8 *data, int offset)
         {
             return static_cast<u16>(data[offset] << 8) | data[offset + 1];
         }
 
-        void modifyRadio(std::vector<Slot> &mons, const std::vector<u8> &data, const PersonalInfo *info, int radio)
+        void modifyRadio(std::vector<Slot> &mons, const u8 *data, const PersonalInfo *info, int radio)
         {
             u16 specie1;
             u16 specie2;
@@ -111,7 +107,7 @@ namespace Encounters4
             mons[5].setSpecie(specie2, info[specie2]);
         }
 
-        void modifyTime(std::vector<Slot> &mons, const std::vector<u8> &data, const PersonalInfo *info, int time)
+        void modifyTime(std::vector<Slot> &mons, const u8 *data, const PersonalInfo *info, int time)
         {
             u16 specie1;
             u16 specie2;
@@ -134,7 +130,7 @@ namespace Encounters4
             mons[3].setSpecie(specie2, info[specie2]);
         }
 
-        void modifyDual(std::vector<Slot> &mons, const std::vector<u8> &data, const PersonalInfo *info, Game dual)
+        void modifyDual(std::vector<Slot> &mons, const u8 *data, const PersonalInfo *info, Game dual)
         {
             u16 specie1;
             u16 specie2;
@@ -172,7 +168,7 @@ namespace Encounters4
             mons[9].setSpecie(specie2, info[specie2]);
         }
 
-        void modifyRadar(std::vector<Slot> &mons, const std::vector<u8> &data, const PersonalInfo *info, bool radar)
+        void modifyRadar(std::vector<Slot> &mons, const u8 *data, const PersonalInfo *info, bool radar)
         {
             if (radar)
             {
@@ -184,8 +180,7 @@ namespace Encounters4
             }
         }
 
-        void modifySwarmHGSS(std::vector<Slot> &mons, const std::vector<u8> &data, const PersonalInfo *info, Encounter encounter,
-                             bool swarm)
+        void modifySwarmHGSS(std::vector<Slot> &mons, const u8 *data, const PersonalInfo *info, Encounter encounter, bool swarm)
         {
             if (swarm)
             {
@@ -216,7 +211,7 @@ namespace Encounters4
             }
         }
 
-        void modifySwarmDPPt(std::vector<Slot> &mons, const std::vector<u8> &data, const PersonalInfo *info, bool swarm)
+        void modifySwarmDPPt(std::vector<Slot> &mons, const u8 *data, const PersonalInfo *info, bool swarm)
         {
             if (swarm)
             {
@@ -226,8 +221,7 @@ namespace Encounters4
             }
         }
 
-        std::vector<EncounterArea4> getHGSS(const std::vector<u8> &data, const Profile4 &profile, const PersonalInfo *info,
-                                            Encounter encounter, int time)
+        std::vector<EncounterArea4> getHGSS(const u8 *data, const Profile4 &profile, const PersonalInfo *info, int time)
         {
             std::vector<EncounterArea4> encounters;
             u8 location = data[0];
@@ -246,7 +240,7 @@ namespace Encounters4
                 }
 
                 modifyRadio(grass, data, info, profile.getRadio());
-                modifySwarmHGSS(grass, data, info, encounter, profile.getSwarm());
+                modifySwarmHGSS(grass, data, info, Encounter::Grass, profile.getSwarm());
 
                 encounters.emplace_back(location, Encounter::Grass, grass);
             }
@@ -325,21 +319,21 @@ namespace Encounters4
                     super.emplace_back(specie, min, max, info[specie]);
                 }
 
-                modifySwarmHGSS(surf, data, info, encounter, profile.getSwarm());
+                modifySwarmHGSS(surf, data, info, Encounter::Surfing, profile.getSwarm());
                 encounters.emplace_back(location, Encounter::Surfing, surf);
 
                 encounters.emplace_back(location, Encounter::OldRod, old);
 
-                modifySwarmHGSS(good, data, info, encounter, profile.getSwarm());
+                modifySwarmHGSS(good, data, info, Encounter::GoodRod, profile.getSwarm());
                 encounters.emplace_back(location, Encounter::GoodRod, good);
 
-                modifySwarmHGSS(super, data, info, encounter, profile.getSwarm());
+                modifySwarmHGSS(super, data, info, Encounter::SuperRod, profile.getSwarm());
                 encounters.emplace_back(location, Encounter::SuperRod, super);
             }
             return encounters;
         }
 
-        std::vector<EncounterArea4> getDPPt(const std::vector<u8> &data, const Profile4 &profile, const PersonalInfo *info, int time)
+        std::vector<EncounterArea4> getDPPt(const u8 *data, const Profile4 &profile, const PersonalInfo *info, int time)
         {
             std::vector<EncounterArea4> encounters;
             u8 location = data[0];
@@ -400,20 +394,60 @@ namespace Encounters4
             }
             return encounters;
         }
+
+        // Parsed areas of every encounter type for the last time and profile options used with each game
+        struct AreaCache
+        {
+            int time;
+            int radio;
+            bool swarm;
+            Game dual;
+            bool radar;
+            std::vector<EncounterArea4> areas;
+        };
+
+        std::map<Game, AreaCache> cache;
+        std::mutex mutex;
+
+        const std::vector<EncounterArea4> &getCachedAreas(int time, const Profile4 &profile)
+        {
+            Game game = profile.getVersion();
+
+            auto it = cache.find(game);
+            if (it != cache.end())
+            {
+                const AreaCache &entry = it->second;
+                if (entry.time == time && entry.radio == profile.getRadio() && entry.swarm == profile.getSwarm()
+                    && entry.dual == profile.getDualSlot() && entry.radar == profile.getRadar())
+                {
+                    return entry.areas;
+                }
+            }
+
+            auto info = PersonalLoader4::getPersonal();
+
+            std::vector<EncounterArea4> areas;
+            for (const u8 *data : getData(game))
+            {
+                auto area = (game & Game::HGSS) ? getHGSS(data, profile, info, time) : getDPPt(data, profile, info, time);
+                areas.insert(areas.end(), area.begin(), area.end());
+            }
+
+            AreaCache &entry = cache[game];
+            entry = { time, profile.getRadio(), profile.getSwarm(), profile.getDualSlot(), profile.getRadar(), std::move(areas) };
+            return entry.areas;
+        }
     }
 
     std::vector<EncounterArea4> getEncounters(Encounter encounter, int time, const Profile4 &profile)
     {
-        std::vector<EncounterArea4> encounters;
-        auto info = PersonalLoader4::getPersonal();
+        std::lock_guard<std::mutex> lock(mutex);
 
-        for (const auto &data : getData(profile.getVersion()))
-        {
-            auto areas
-                = (profile.getVersion() & Game::HGSS) ? getHGSS(data, profile, info, encounter, time) : getDPPt(data, profile, info, time);
-            std::copy_if(areas.begin(), areas.end(), std::back_inserter(encounters),
-                         [&encounter](const EncounterArea4 &area) { return area.getEncounter() == encounter; });
-        }
+        const auto &areas = getCachedAreas(time, profile);
+
+        std::vector<EncounterArea4> encounters;
+        std::copy_if(areas.begin(), areas.end(), std::back_inserter(encounters),
+                     [&encounter](const EncounterArea4 &area) { return area.getEncounter() == encounter; });
 
         return encounters;
     }
@@ -19,18 +19,73 @@
 
 #include "EggSearcher4.hpp"
 #include <Core/Gen4/Generators/EggGenerator4.hpp>
+#include <future>
 
 EggSearcher4::EggSearcher4(u16 tid, u16 sid, u8 genderRatio, Method method, const StateFilter &filter) :
-    Searcher(tid, sid, genderRatio, method, filter), searching(false), progress(0)
+    Searcher(tid, sid, genderRatio, method, filter), searching(false), progress(0), total(0)
 {
 }
 
-void EggSearcher4::startSearch(u32 minDelay, u32 maxDelay, int type, const EggGenerator4 &generatorIV, const EggGenerator4 &generatorPID)
+void EggSearcher4::startSearch(int threads, u32 minDelay, u32 maxDelay, int type, const EggGenerator4 &generatorIV,
+                               const EggGenerator4 &generatorPID)
 {
     searching = true;
-    u16 total = 0;
 
-    for (u16 ab = 0; ab < 256; ab++)
+    if (threads < 1)
+    {
+        threads = 1;
+    }
+    else if (threads > 256)
+    {
+        threads = 256;
+    }
+
+    std::vector<std::future<void>> threadContainer;
+
+    u16 split = 256 / threads;
+    u16 start = 0;
+    for (int i = 0; i < threads; i++)
+    {
+        if (i == threads - 1)
+        {
+            threadContainer.emplace_back(
+                std::async(std::launch::async, [=] { search(start, 256, minDelay, maxDelay, type, generatorIV, generatorPID); }));
+        }
+        else
+        {
+            threadContainer.emplace_back(
+                std::async(std::launch::async, [=] { search(start, start + split, minDelay, maxDelay, type, generatorIV, generatorPID); }));
+        }
+        start += split;
+    }
+
+    for (int i = 0; i < threads; i++)
+    {
+        threadContainer[i].wait();
+    }
+}
+
+void EggSearcher4::cancelSearch()
+{
+    searching = false;
+}
+
+std::vector<EggState4> EggSearcher4::getResults()
+{
+    std::lock_guard<std::mutex> guard(mutex);
+    auto data = std::move(results);
+    return data;
+}
+
+int EggSearcher4::getProgress() const
+{
+    return progress;
+}
+
+void EggSearcher4::search(u16 start, u16 end, u32 minDelay, u32 maxDelay, int type, const EggGenerator4 &generatorIV,
+                          const EggGenerator4 &generatorPID)
+{
+    for (u16 ab = start; ab < end; ab++)
     {
         for (u8 cd = 0; cd < 24; cd++)
         {
@@ -60,59 +115,62 @@ void EggSearcher4::startSearch(u32 minDelay, u32 maxDelay, int type, const EggGe
                 }
                 else
                 {
-                    auto statesIV = generatorIV.generate(seed);
-                    auto statesPID = generatorPID.generate(seed);
+                    states = searchCombined(seed, generatorIV, generatorPID);
+                }
 
-                    if (!statesIV.empty() && !statesPID.empty())
+                if (!states.empty())
+                {
+                    for (EggState4 &state : states)
                     {
-                        for (auto statePID : statesPID)
-                        {
-                            for (const auto &stateIV : statesIV)
-                            {
-                                statePID.setIVs(stateIV.getIV(0), stateIV.getIV(1), stateIV.getIV(2), stateIV.getIV(3), stateIV.getIV(4),
-                                                stateIV.getIV(5));
-                                statePID.calculateHiddenPower();
-
-                                for (u8 i = 0; i < 6; i++)
-                                {
-                                    statePID.setInheritance(i, stateIV.getInheritance(i));
-                                }
-                                statePID.setSecondaryAdvance(stateIV.getAdvances());
-
-                                states.emplace_back(statePID);
-                            }
-                        }
+                        state.setInitialSeed(seed);
                     }
-                }
 
-                for (EggState4 &state : states)
-                {
-                    state.setInitialSeed(seed);
-                }
+                    total += states.size();
 
-                total += states.size();
+                    std::lock_guard<std::mutex> guard(mutex);
+                    results.insert(results.end(), states.begin(), states.end());
+                }
 
-                std::lock_guard<std::mutex> guard(mutex);
-                results.insert(results.end(), states.begin(), states.end());
                 progress++;
             }
         }
     }
 }
 
-void EggSearcher4::cancelSearch()
+std::vector<EggState4> EggSearcher4::searchCombined(u32 seed, const EggGenerator4 &generatorIV, const EggGenerator4 &generatorPID) const
 {
-    searching = false;
-}
+    std::vector<EggState4> states;
 
-std::vector<EggState4> EggSearcher4::getResults()
-{
-    std::lock_guard<std::mutex> guard(mutex);
-    auto data = std::move(results);
-    return data;
-}
+    // The IV half is the more restrictive filter, only run the PID half if it produced anything
+    auto statesIV = generatorIV.generate(seed);
+    if (statesIV.empty())
+    {
+        return states;
+    }
 
-int EggSearcher4::getProgress() const
-{
-    return progress;
+    auto statesPID = generatorPID.generate(seed);
+    if (statesPID.empty())
+    {
+        return states;
+    }
+
+    states.reserve(statesIV.size() * statesPID.size());
+    for (auto statePID : statesPID)
+    {
+        for (const auto &stateIV : statesIV)
+        {
+            statePID.setIVs(stateIV.getIV(0), stateIV.getIV(1), stateIV.getIV(2), stateIV.getIV(3), stateIV.getIV(4), stateIV.getIV(5));
+            statePID.calculateHiddenPower();
+
+            for (u8 i = 0; i < 6; i++)
+            {
+                statePID.setInheritance(i, stateIV.getInheritance(i));
+            }
+            statePID.setSecondaryAdvance(stateIV.getAdvances());
+
+            states.emplace_back(statePID);
+        }
+    }
+
+    return states;
 }
@@ -21,6 +21,7 @@
 #define EGGSEARCHER4_HPP
 
 #include <Core/Parents/Searchers/Searcher.hpp>
+#include <atomic>
 #include <mutex>
 
 class EggGenerator4;
@@ -31,16 +32,22 @@ class EggSearcher4 : public Searcher
 public:
     EggSearcher4() = default;
     EggSearcher4(u16 tid, u16 sid, u8 genderRatio, Method method, const StateFilter &filter);
-    void startSearch(u32 minDelay, u32 maxDelay, int type, const EggGenerator4 &generatorIV, const EggGenerator4 &generatorPID);
+    void startSearch(int threads, u32 minDelay, u32 maxDelay, int type, const EggGenerator4 &generatorIV,
+                     const EggGenerator4 &generatorPID);
     void cancelSearch();
     std::vector<EggState4> getResults();
     int getProgress() const;
 
 private:
     bool searching;
-    int progress;
+    std::atomic<int> progress;
+    std::atomic<u32> total;
     std::vector<EggState4> results;
     std::mutex mutex;
+
+    void search(u16 start, u16 end, u32 minDelay, u32 maxDelay, int type, const EggGenerator4 &generatorIV,
+                const EggGenerator4 &generatorPID);
+    std::vector<EggState4> searchCombined(u32 seed, const EggGenerator4 &generatorIV, const EggGenerator4 &generatorPID) const;
 };
 
 #endif // EGGSEARCHER4_HPP
@@ -129,9 +129,11 @@ std::vector<StationaryState> StationarySearcher4::searchMethod1(u8 hp, u8 atk, u
         return states;
     }
 
-    auto seeds = cache.recoverLower16BitsIV(hp, atk, def, spa, spd, spe);
-    for (const u32 seed : seeds)
+    std::array<u32, RNGCache::maxSeeds> seeds;
+    u8 count = cache.recoverLower16BitsIV(hp, atk, def, spa, spd, spe, seeds);
+    for (u8 i = 0; i < count; i++)
     {
+        u32 seed = seeds[i];
         // Setup normal state
         PokeRNGR rng(seed);
         u16 high = rng.nextUShort();
@@ -174,9 +176,11 @@ std::vector<StationaryState> StationarySearcher4::searchMethodJ(u8 hp, u8 atk, u
         return states;
     }
 
-    auto seeds = cache.recoverLower16BitsIV(hp, atk, def, spa, spd, spe);
-    for (const u32 val : seeds)
+    std::array<u32, RNGCache::maxSeeds> seeds;
+    u8 count = cache.recoverLower16BitsIV(hp, atk, def, spa, spd, spe, seeds);
+    for (u8 i = 0; i < count; i++)
     {
+        u32 val = seeds[i];
         PokeRNGR rng(val);
         u16 high = rng.nextUShort();
         u16 low = rng.nextUShort();
@@ -252,9 +256,11 @@ std::vector<StationaryState> StationarySearcher4::searchMethodK(u8 hp, u8 atk, u
         return states;
     }
 
-    auto seeds = cache.recoverLower16BitsIV(hp, atk, def, spa, spd, spe);
-    for (const u32 val : seeds)
+    std::array<u32, RNGCache::maxSeeds> seeds;
+    u8 count = cache.recoverLower16BitsIV(hp, atk, def, spa, spd, spe, seeds);
+    for (u8 i = 0; i < count; i++)
     {
+        u32 val = seeds[i];
         PokeRNGR rng(val);
         u16 high = rng.nextUShort();
         u16 low = rng.nextUShort();
@@ -330,9 +336,11 @@ std::vector<StationaryState> StationarySearcher4::searchWondercardIVs(u8 hp, u8
         return states;
     }
 
-    auto seeds = cache.recoverLower16BitsIV(hp, atk, def, spa, spd, spe);
-    for (const u32 seed : seeds)
+    std::array<u32, RNGCache::maxSeeds> seeds;
+    u8 count = cache.recoverLower16BitsIV(hp, atk, def, spa, spd, spe, seeds);
+    for (u8 i = 0; i < count; i++)
     {
+        u32 seed = seeds[i];
         // Setup normal state
         PokeRNGR rng(seed);
         state.setSeed(rng.next());
@@ -139,9 +139,11 @@ std::vector<WildState> WildSearcher4::searchMethodJ(u8 hp, u8 atk, u8 def, u8 sp
         return states;
     }
 
-    auto seeds = cache.recoverLower16BitsIV(hp, atk, def, spa, spd, spe);
-    for (const u32 val : seeds)
+    std::array<u32, RNGCache::maxSeeds> seeds;
+    u8 count = cache.recoverLower16BitsIV(hp, atk, def, spa, spd, spe, seeds);
+    for (u8 i = 0; i < count; i++)
     {
+        u32 val = seeds[i];
         PokeRNGR rng(val);
         u16 high = rng.nextUShort();
         u16 low = rng.nextUShort();
@@ -223,9 +225,11 @@ std::vector<WildState> WildSearcher4::searchMethodK(u8 hp, u8 atk, u8 def, u8 sp
         return states;
     }
 
-    auto seeds = cache.recoverLower16BitsIV(hp, atk, def, spa, spd, spe);
-    for (const u32 val : seeds)
+    std::array<u32, RNGCache::maxSeeds> seeds;
+    u8 count = cache.recoverLower16BitsIV(hp, atk, def, spa, spd, spe, seeds);
+    for (u8 i = 0; i < count; i++)
     {
+        u32 val = seeds[i];
         PokeRNGR rng(val);
         u16 high = rng.nextUShort();
         u16 low = rng.nextUShort();
@@ -307,9 +311,11 @@ std::vector<WildState> WildSearcher4::searchChainedShiny(u8 hp, u8 atk, u8 def,
         return states;
     }
 
-    auto seeds = cache.recoverLower16BitsIV(hp, atk, def, spa, spd, spe);
-    for (const auto &seed : seeds)
+    std::array<u32, RNGCache::maxSeeds> seeds;
+    u8 count = cache.recoverLower16BitsIV(hp, atk, def, spa, spd, spe, seeds);
+    for (u8 j = 0; j < count; j++)
     {
+        u32 seed = seeds[j];
         PokeRNGR rng(seed);
 
         u16 low = 0;
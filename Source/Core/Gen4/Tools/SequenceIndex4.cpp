@@ -0,0 +1,134 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "SequenceIndex4.hpp"
+#include <Core/Enum/Game.hpp>
+#include <Core/Gen4/SeedTime.hpp>
+#include <Core/RNG/LCRNG.hpp>
+#include <Core/RNG/MTFast.hpp>
+#include <algorithm>
+
+namespace
+{
+    constexpr u8 sequenceLength = 20;
+
+    // Packs the sequence starting at the given position with the first symbol in the top bits
+    // Symbols are offset by one so a shorter suffix can never match a longer sequence
+    u64 packSuffix(const u8 *symbols, u8 length)
+    {
+        u64 key = 0;
+        for (u8 i = 0; i < length; i++)
+        {
+            key |= static_cast<u64>(symbols[i] + 1) << (62 - 2 * i);
+        }
+        return key;
+    }
+}
+
+SequenceIndex4::SequenceIndex4(const std::vector<SeedTime> &seedTimes) : size(static_cast<u32>(seedTimes.size()))
+{
+    suffixes.reserve(seedTimes.size() * sequenceLength);
+
+    u8 symbols[sequenceLength];
+    for (u32 index = 0; index < size; index++)
+    {
+        const auto &seedTime = seedTimes[index];
+        if (seedTime.getVersion() & Game::HGSS)
+        {
+            u64 calls = packCalls(seedTime.getSeed(), seedTime.getInfo().getSkips());
+            for (u8 i = 0; i < sequenceLength; i++)
+            {
+                symbols[i] = (calls >> (2 * i)) & 3;
+            }
+        }
+        else
+        {
+            u32 flips = packCoinFlips(seedTime.getSeed());
+            for (u8 i = 0; i < sequenceLength; i++)
+            {
+                symbols[i] = (flips >> i) & 1;
+            }
+        }
+
+        for (u8 i = 0; i < sequenceLength; i++)
+        {
+            suffixes.emplace_back(Suffix { packSuffix(&symbols[i], sequenceLength - i), index });
+        }
+    }
+
+    std::sort(suffixes.begin(), suffixes.end());
+}
+
+std::vector<bool> SequenceIndex4::search(const std::vector<u8> &sequence) const
+{
+    std::vector<bool> possible(size, false);
+    if (sequence.empty() || sequence.size() > sequenceLength)
+    {
+        return possible;
+    }
+
+    for (u8 symbol : sequence)
+    {
+        if (symbol > 2)
+        {
+            return possible;
+        }
+    }
+
+    // Every suffix that starts with the sequence lies between the sequence padded with zeros and padded with ones
+    u8 length = static_cast<u8>(sequence.size());
+    u64 low = packSuffix(sequence.data(), length);
+    u64 high = low | ((1ULL << (64 - 2 * length)) - 1);
+
+    auto begin = std::lower_bound(suffixes.begin(), suffixes.end(), Suffix { low, 0 });
+    auto end = std::upper_bound(begin, suffixes.end(), Suffix { high, 0 });
+    for (auto it = begin; it != end; it++)
+    {
+        possible[it->index] = true;
+    }
+
+    return possible;
+}
+
+u32 SequenceIndex4::packCoinFlips(u32 seed)
+{
+    u32 flips = 0;
+
+    MTFast<sequenceLength> mt(seed);
+    for (u8 i = 0; i < sequenceLength; i++)
+    {
+        flips |= (mt.next() & 1) << i;
+    }
+
+    return flips;
+}
+
+u64 SequenceIndex4::packCalls(u32 seed, u8 skips)
+{
+    u64 calls = 0;
+
+    PokeRNG rng(seed);
+    rng.advance(skips);
+    for (u8 i = 0; i < sequenceLength; i++)
+    {
+        calls |= static_cast<u64>(rng.nextUShort() % 3) << (2 * i);
+    }
+
+    return calls;
+}
@@ -0,0 +1,54 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SEQUENCEINDEX4_HPP
+#define SEQUENCEINDEX4_HPP
+
+#include <Core/Util/Global.hpp>
+#include <vector>
+
+class SeedTime;
+
+// Indexes the coin flips (DPPt) or Elm/Irwin calls (HGSS) of a list of seeds as packed integers
+// Coin flips are stored as 0 = T, 1 = H and calls as 0 = E, 1 = K, 2 = P
+class SequenceIndex4
+{
+public:
+    explicit SequenceIndex4(const std::vector<SeedTime> &seedTimes);
+    std::vector<bool> search(const std::vector<u8> &sequence) const;
+    static u32 packCoinFlips(u32 seed);
+    static u64 packCalls(u32 seed, u8 skips);
+
+private:
+    struct Suffix
+    {
+        u64 key;
+        u32 index;
+
+        bool operator<(const Suffix &other) const
+        {
+            return key < other.key;
+        }
+    };
+
+    std::vector<Suffix> suffixes;
+    u32 size;
+};
+
+#endif // SEQUENCEINDEX4_HPP
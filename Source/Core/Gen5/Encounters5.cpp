@@ -22,10 +22,11 @@
 #include <Core/Enum/Game.hpp>
 #include <Core/Gen5/EncounterArea5.hpp>
 #include <Core/Parents/PersonalLoader.hpp>
-#include <Core/Resources/Encounters.hpp>
+#include <Core/Util/ResourceLoader.hpp>
 #include <algorithm>
-#include <cstring>
 #include <iterator>
+#include <map>
+#include <mutex>
 
 namespace Encounters5
 {
@@ -34,35 +35,33 @@ namespace Encounters5
         constexpr u8 bwLocations[12] = { 2, 44, 45, 46, 47, 48, 49, 73, 84, 88, 93, 94 };
         constexpr u8 bw2Locations[13] = { 2, 23, 24, 25, 26, 27, 28, 43, 107, 111, 116, 117, 129 };
 
-        std::vector<std::vector<u8>> getData(Game game)
+        std::vector<std::pair<const u8 *, int>> getData(Game game)
         {
-            const u8 *data;
-            size_t size;
+            std::string name;
 
             if (game == Game::Black)
             {
-                data = black.data();
-                size = black.size();
+                name = "black";
             }
             else if (game == Game::Black2)
             {
-                data = black2.data();
-                size = black2.size();
+                name = "black2";
             }
             else if (game == Game::White)
             {
-                data = white.data();
-                size = white.size();
+                name = "white";
             }
             else
             {
-                data = white2.data();
-                size = white2.size();
+                name = "white2";
             }
 
-            std::vector<std::vector<u8>> encounters;
+            // Records are read in place from the decompressed resource
+            const std::vector<u8> &resource = ResourceLoader::getResource(name);
+
+            std::vector<std::pair<const u8 *, int>> encounters;
             int count = 0;
-            for (size_t i = 0; i < size;)
+            for (size_t i = 0; i < resource.size();)
             {
                 int length;
                 if (game & Game::BW)
@@ -88,18 +87,16 @@ namespace Encounters5
                     }
                 }
 
-                std::vector<u8> entry(length);
-                std::memcpy(entry.data(), data + i, size);
-                encounters.emplace_back(entry);
+                encounters.emplace_back(resource.data() + i, length);
 
-                i += size;
+                i += length;
                 count++;
             }
 
             return encounters;
         }
 
-        u16 getValue(const std::vector<u8> &data, int offset)
+        u16 getValue(const u8 *data, int offset)
         {
             return static_cast<u16>(data[offset + 1] << 8) | data[offset];
         }
@@ -114,19 +111,18 @@ namespace Encounters5
             return personal;
         }
 
-        std::vector<EncounterArea5> getAreas(const std::vector<u8> &data, Encounter encounter, const PersonalInfo *info, u8 location,
-                                             u8 season)
+        std::vector<EncounterArea5> getAreas(const u8 *data, int length, const PersonalInfo *info, u8 location, u8 season)
         {
             std::vector<EncounterArea5> encounters;
 
             int offset = 0;
-            if (season != 0 && data.size() != 232)
+            if (season != 0 && length != 232)
             {
                 offset = (season - 1) * 232;
             }
 
             // Grass
-            if (data[offset] != 0 && encounter == Encounter::Grass)
+            if (data[offset] != 0)
             {
                 std::vector<Slot> grass;
                 for (int i = 0; i < 12; i++)
@@ -140,7 +136,7 @@ namespace Encounters5
             }
 
             // Double Grass
-            if (data[offset + 1] != 0 && encounter == Encounter::DoubleGrass)
+            if (data[offset + 1] != 0)
             {
                 std::vector<Slot> doubleGrass;
                 for (int i = 0; i < 12; i++)
@@ -154,7 +150,7 @@ namespace Encounters5
             }
 
             // Special Grass
-            if (data[offset + 2] != 0 && encounter == Encounter::SpecialGrass)
+            if (data[offset + 2] != 0)
             {
                 std::vector<Slot> specialGrass;
                 for (int i = 0; i < 12; i++)
@@ -168,7 +164,7 @@ namespace Encounters5
             }
 
             // Surf
-            if (data[offset + 3] != 0 && encounter == Encounter::Surfing)
+            if (data[offset + 3] != 0)
             {
                 std::vector<Slot> surf;
                 for (int i = 0; i < 5; i++)
@@ -182,7 +178,7 @@ namespace Encounters5
             }
 
             // Special Surf
-            if (data[offset + 4] != 0 && encounter == Encounter::SpecialSurf)
+            if (data[offset + 4] != 0)
             {
                 std::vector<Slot> specialSurf;
                 for (int i = 0; i < 5; i++)
@@ -196,7 +192,7 @@ namespace Encounters5
             }
 
             // Fish
-            if (data[offset + 5] != 0 && encounter == Encounter::SuperRod)
+            if (data[offset + 5] != 0)
             {
                 std::vector<Slot> fish;
                 for (int i = 0; i < 5; i++)
@@ -210,7 +206,7 @@ namespace Encounters5
             }
 
             // Special Fish
-            if (data[offset + 6] != 0 && encounter == Encounter::SpecialSuperRod)
+            if (data[offset + 6] != 0)
             {
                 std::vector<Slot> specialFish;
                 for (int i = 0; i < 5; i++)
@@ -225,19 +221,50 @@ namespace Encounters5
 
             return encounters;
         }
+
+        // Parsed areas of every encounter type for the last season used with each game
+        struct AreaCache
+        {
+            u8 season;
+            std::vector<EncounterArea5> areas;
+        };
+
+        std::map<Game, AreaCache> cache;
+        std::mutex mutex;
+
+        const std::vector<EncounterArea5> &getCachedAreas(u8 season, Game version)
+        {
+            auto it = cache.find(version);
+            if (it != cache.end() && it->second.season == season)
+            {
+                return it->second.areas;
+            }
+
+            auto info = PersonalLoader5::getPersonal();
+            const auto &encounterData = getData(version);
+
+            std::vector<EncounterArea5> areas;
+            for (size_t i = 0; i < encounterData.size(); i++)
+            {
+                auto area = getAreas(encounterData[i].first, encounterData[i].second, info, i, season);
+                areas.insert(areas.end(), area.begin(), area.end());
+            }
+
+            AreaCache &entry = cache[version];
+            entry = { season, std::move(areas) };
+            return entry.areas;
+        }
     }
 
     std::vector<EncounterArea5> getEncounters(Encounter encounter, u8 season, Game version)
     {
-        std::vector<EncounterArea5> encounters;
-        auto info = PersonalLoader5::getPersonal();
+        std::lock_guard<std::mutex> lock(mutex);
 
-        const auto &encounterData = getData(version);
-        for (size_t i = 0; i < encounterData.size(); i++)
-        {
-            auto areas = getAreas(encounterData[i], encounter, info, i, season);
-            encounters.insert(encounters.end(), areas.begin(), areas.end());
-        }
+        const auto &areas = getCachedAreas(season, version);
+
+        std::vector<EncounterArea5> encounters;
+        std::copy_if(areas.begin(), areas.end(), std::back_inserter(encounters),
+                     [&encounter](const EncounterArea5 &area) { return area.getEncounter() == encounter; });
 
         return encounters;
     }
@@ -26,7 +26,7 @@
 class Den
 {
 public:
-    constexpr Den(u64 hash, const std::array<Raid, 12> &sword, const std::array<Raid, 12> &shield) :
+    Den(u64 hash, const std::array<Raid, 12> &sword, const std::array<Raid, 12> &shield) :
         hash(hash), sword(sword), shield(shield)
     {
     }
@@ -36,12 +36,12 @@ public:
         return hash;
     }
 
-    Raid getRaid(u8 index, Game version) const
+    const Raid &getRaid(u8 index, Game version) const
     {
         return (version == Game::Sword) ? sword[index] : shield[index];
     }
 
-    std::array<Raid, 12> getRaids(Game version) const
+    const std::array<Raid, 12> &getRaids(Game version) const
     {
         return (version == Game::Sword) ? sword : shield;
     }
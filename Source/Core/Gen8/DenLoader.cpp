@@ -18,8 +18,11 @@
  */
 
 #include "DenLoader.hpp"
-#include <Core/Resources/Encounters.hpp>
+#include <Core/Parents/PersonalLoader.hpp>
+#include <Core/Util/ResourceLoader.hpp>
 #include <algorithm>
+#include <utility>
+#include <vector>
 
 // Normal hash, rare hash, location, x, y
 constexpr u64 denInfo[276][5] = {
@@ -303,11 +306,78 @@ constexpr u64 denInfo[276][5] = {
 
 namespace DenLoader
 {
-    Den getDen(u16 index, u8 rarity)
+    namespace
     {
-        u64 tableHash = denInfo[index][rarity];
-        auto it = std::lower_bound(nests.begin(), nests.end(), tableHash, [](const Den& den, u64 hash) { return den.getHash() < hash; });
-        return *it;
+        // Record layout written by embed.py
+        constexpr size_t raidSize = 8;
+        constexpr size_t denSize = 8 + 24 * raidSize;
+
+        struct DenTable
+        {
+            std::vector<Den> dens;
+            u16 index[276][2];
+        };
+
+        Raid getRaid(const u8 *data)
+        {
+            u16 species = static_cast<u16>(data[0] | (data[1] << 8));
+            u8 altform = data[2];
+            u8 stars = data[7];
+            return Raid(data[3], altform, data[4], data[5], data[6], species, PersonalLoader8::getPersonal(species, altform),
+                        { (stars & 1) != 0, (stars & 2) != 0, (stars & 4) != 0, (stars & 8) != 0, (stars & 16) != 0 });
+        }
+
+        template <size_t... i>
+        std::array<Raid, 12> getRaids(const u8 *data, std::index_sequence<i...>)
+        {
+            return { getRaid(data + i * raidSize)... };
+        }
+
+        DenTable loadTable()
+        {
+            const std::vector<u8> &nests = ResourceLoader::getResource("nests");
+
+            DenTable table;
+            table.dens.reserve(nests.size() / denSize);
+            for (size_t offset = 0; offset < nests.size(); offset += denSize)
+            {
+                const u8 *data = nests.data() + offset;
+
+                u64 hash = 0;
+                for (int i = 7; i >= 0; i--)
+                {
+                    hash = (hash << 8) | data[i];
+                }
+
+                table.dens.emplace_back(hash, getRaids(data + 8, std::make_index_sequence<12>()),
+                                        getRaids(data + 8 + 12 * raidSize, std::make_index_sequence<12>()));
+            }
+
+            // Resolve the hash of every den/rarity pair once so lookups are a plain index
+            for (u16 i = 0; i < 276; i++)
+            {
+                for (u8 rarity = 0; rarity < 2; rarity++)
+                {
+                    auto it = std::lower_bound(table.dens.begin(), table.dens.end(), denInfo[i][rarity],
+                                               [](const Den &den, u64 hash) { return den.getHash() < hash; });
+                    table.index[i][rarity] = static_cast<u16>(std::distance(table.dens.begin(), it));
+                }
+            }
+
+            return table;
+        }
+
+        const DenTable &getTable()
+        {
+            static const DenTable table = loadTable();
+            return table;
+        }
+    }
+
+    const Den &getDen(u16 index, u8 rarity)
+    {
+        const DenTable &table = getTable();
+        return table.dens[table.index[index][rarity]];
     }
 
     u8 getLocation(u16 index)
@@ -24,7 +24,7 @@
 
 namespace DenLoader
 {
-    Den getDen(u16 index, u8 rarity);
+    const Den &getDen(u16 index, u8 rarity);
     u8 getLocation(u16 index);
     std::array<u16, 2> getCoordinates(u16 index);
 };
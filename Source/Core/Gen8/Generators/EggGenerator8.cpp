@@ -46,131 +46,157 @@ std::vector<EggState> EggGenerator8::generate(u64 seed0, u64 seed1) const
         pidRolls += 2;
     }
 
+    u8 everstoneCount = daycare.getEverstoneCount(Game::BDSP);
+    u8 parentAbility = daycare.getParentAbility(1);
+
+    // Intentionally ignoring power items
+    u8 inheritance = 3;
+    if (daycare.getParentItem(0) == 8 || daycare.getParentItem(1) == 8)
+    {
+        inheritance = 5;
+    }
+
+    // Each advance uses the next two outputs of the main RNG, consecutive advances share one of them
+    // Sliding over the outputs avoids copying the RNG and stepping it three times per advance
+    u32 compatibilityRand = rng.next();
+
     std::vector<EggState> states;
-    for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rng.next())
+    for (u32 cnt = 0; cnt <= maxAdvances; cnt++)
     {
-        Xorshift check(rng);
-        if (check.next(100) < compatability)
+        u32 eggSeed = rng.next();
+        bool compatible = compatibilityRand % 100 < compatability;
+        compatibilityRand = eggSeed;
+
+        if (!compatible)
         {
-            EggState state(initialAdvances + cnt);
-            XoroshiroBDSP gen(check.next());
+            continue;
+        }
 
-            // Nidoran
-            // gen.next(2)
+        EggState state(initialAdvances + cnt);
+        XoroshiroBDSP gen(eggSeed);
 
-            // Illumise/Volbeat
-            // gen.next(2)
+        // Nidoran
+        // gen.next(2)
 
-            // Indeedee
-            // gen.next(2)
+        // Illumise/Volbeat
+        // gen.next(2)
 
-            if (genderRatio == 255)
-            {
-                state.setGender(2);
-            }
-            else if (genderRatio == 254)
-            {
-                state.setGender(1);
-            }
-            else if (genderRatio == 0)
-            {
-                state.setGender(0);
-            }
-            else
-            {
-                u8 gender = gen.nextUInt(252) + 1 < genderRatio;
-                state.setGender(gender);
-            }
+        // Indeedee
+        // gen.next(2)
 
-            u8 nature = gen.nextUInt(25);
-            if (daycare.getEverstoneCount(Game::BDSP) == 2)
-            {
-                nature = daycare.getParentNature(gen.nextUInt(2));
-            }
-            else if (daycare.getParentItem(0) == 1)
-            {
-                nature = daycare.getParentNature(0);
-            }
-            else if (daycare.getParentItem(1) == 1)
-            {
-                nature = daycare.getParentNature(1);
-            }
-            state.setNature(nature);
+        if (genderRatio == 255)
+        {
+            state.setGender(2);
+        }
+        else if (genderRatio == 254)
+        {
+            state.setGender(1);
+        }
+        else if (genderRatio == 0)
+        {
+            state.setGender(0);
+        }
+        else
+        {
+            u8 gender = gen.nextUInt(252) + 1 < genderRatio;
+            state.setGender(gender);
+        }
 
-            u8 ability = gen.nextUInt(100);
-            u8 parentAbility = daycare.getParentAbility(1);
-            if (parentAbility == 2)
-            {
-                ability = ability < 20 ? 0 : ability < 40 ? 1 : 2;
-            }
-            else if (parentAbility == 1)
-            {
-                ability = ability < 20 ? 0 : 1;
-            }
-            else
-            {
-                ability = ability < 80 ? 0 : 1;
-            }
-            state.setAbility(ability);
+        u8 nature = gen.nextUInt(25);
+        if (everstoneCount == 2)
+        {
+            nature = daycare.getParentNature(gen.nextUInt(2));
+        }
+        else if (daycare.getParentItem(0) == 1)
+        {
+            nature = daycare.getParentNature(0);
+        }
+        else if (daycare.getParentItem(1) == 1)
+        {
+            nature = daycare.getParentNature(1);
+        }
+        state.setNature(nature);
 
-            // Intentionally ignoring power items
-            u8 inheritance = 3;
-            if (daycare.getParentItem(0) == 8 || daycare.getParentItem(1) == 8)
-            {
-                inheritance = 5;
-            }
+        // Early gender/nature filter skips the rest of the egg
+        if (!filter.compareGender(state) || !filter.compareNature(state))
+        {
+            continue;
+        }
 
-            // Determine inheritance
-            for (u8 i = 0; i < inheritance;)
-            {
-                u8 index = gen.nextUInt(6);
-                if (state.getInheritance(index) == 0)
-                {
-                    state.setInheritance(index, gen.nextUInt(2) + 1);
-                    i++;
-                }
-            }
+        u8 ability = gen.nextUInt(100);
+        if (parentAbility == 2)
+        {
+            ability = ability < 20 ? 0 : ability < 40 ? 1 : 2;
+        }
+        else if (parentAbility == 1)
+        {
+            ability = ability < 20 ? 0 : 1;
+        }
+        else
+        {
+            ability = ability < 80 ? 0 : 1;
+        }
+        state.setAbility(ability);
 
-            // Assign IVs and inheritance
-            for (u8 i = 0; i < 6; i++)
+        // Determine inheritance
+        for (u8 i = 0; i < inheritance;)
+        {
+            u8 index = gen.nextUInt(6);
+            if (state.getInheritance(index) == 0)
             {
-                u8 iv = gen.nextUInt(32);
-                if (state.getInheritance(i) == 1)
-                {
-                    iv = daycare.getParentIV(0, i);
-                }
-                else if (state.getInheritance(i) == 2)
-                {
-                    iv = daycare.getParentIV(1, i);
-                }
-                state.setIV(i, iv);
+                state.setInheritance(index, gen.nextUInt(2) + 1);
+                i++;
             }
+        }
 
-            // Encryption constant
+        // IVs are only assigned once the PID passes the filter, skip the 6 IV calls and the encryption constant for now
+        XoroshiroBDSP ivs(gen);
+        for (u8 i = 0; i < 7; i++)
+        {
             gen.next();
+        }
 
-            // Assign PID if
-            u32 pid = 0;
-            u16 psv = 0;
-            for (u8 roll = 1; roll < pidRolls; roll++)
+        // Assign PID if
+        u32 pid = 0;
+        u16 psv = 0;
+        for (u8 roll = 1; roll < pidRolls; roll++)
+        {
+            pid = gen.nextUInt(0xffffffff);
+            psv = (pid >> 16) ^ (pid & 0xffff);
+            if ((psv ^ tsv) < 16)
             {
-                pid = gen.nextUInt(0xffffffff);
-                psv = (pid >> 16) ^ (pid & 0xffff);
-                if ((psv ^ tsv) < 16)
-                {
-                    break;
-                }
+                break;
             }
-            state.setPID(pid);
-            state.setShiny<16>(tsv, psv);
+        }
+        state.setPID(pid);
+        state.setShiny<16>(tsv, psv);
 
-            // Ball handling check
-            // Uses a rand call, maybe add later
+        if (!filter.comparePID(state))
+        {
+            continue;
+        }
 
-            if (filter.comparePID(state) && filter.compareIV(state))
+        // Assign IVs and inheritance
+        for (u8 i = 0; i < 6; i++)
+        {
+            u8 iv = ivs.nextUInt(32);
+            if (state.getInheritance(i) == 1)
+            {
+                iv = daycare.getParentIV(0, i);
+            }
+            else if (state.getInheritance(i) == 2)
             {
-                states.emplace_back(state);
+                iv = daycare.getParentIV(1, i);
             }
+            state.setIV(i, iv);
+        }
+
+        // Ball handling check
+        // Uses a rand call, maybe add later
+
+        if (filter.compareIV(state))
+        {
+            states.emplace_back(state);
         }
     }
 
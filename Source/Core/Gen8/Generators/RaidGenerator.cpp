@@ -18,12 +18,53 @@
  */
 
 #include "RaidGenerator.hpp"
-#include <Core/RNG/Xoroshiro.hpp>
 #include <Core/Enum/Method.hpp>
+#include <Core/RNG/SIMD.hpp>
+#include <Core/RNG/Xoroshiro.hpp>
 
 constexpr u8 toxtricityAmpedNatures[13] = { 3, 4, 2, 8, 9, 19, 22, 11, 13, 14, 0, 6, 24 };
 constexpr u8 toxtricityLowKeyNatures[12] = { 1, 5, 7, 10, 12, 15, 16, 17, 18, 20, 21, 23 };
 
+namespace
+{
+    // Four Xoroshiro streams with each 64 bit state half split into its upper and lower 32 bits
+    // Raid calls only ever use the lower 32 bits of the output so the addition never needs the carry
+    struct XoroshiroX4
+    {
+        vuint32x4 high0;
+        vuint32x4 low0;
+        vuint32x4 high1;
+        vuint32x4 low1;
+
+        vuint32x4 next()
+        {
+            vuint32x4 result = v32x4_add(low0, low1);
+
+            high1 = v32x4_xor(high1, high0);
+            low1 = v32x4_xor(low1, low0);
+
+            // state0 = rotl(s0, 24) ^ s1 ^ (s1 << 16)
+            vuint32x4 high = v32x4_or(v32x4_shl<24>(high0), v32x4_shr<8>(low0));
+            vuint32x4 low = v32x4_or(v32x4_shl<24>(low0), v32x4_shr<8>(high0));
+            high0 = v32x4_xor(v32x4_xor(high, high1), v32x4_or(v32x4_shl<16>(high1), v32x4_shr<16>(low1)));
+            low0 = v32x4_xor(v32x4_xor(low, low1), v32x4_shl<16>(low1));
+
+            // state1 = rotl(s1, 37), which is swapping the halves and rotating by 5
+            high = v32x4_or(v32x4_shl<5>(low1), v32x4_shr<27>(high1));
+            low = v32x4_or(v32x4_shl<5>(high1), v32x4_shr<27>(low1));
+            high1 = high;
+            low1 = low;
+
+            return result;
+        }
+
+        vuint32x4 peek() const
+        {
+            return v32x4_add(low0, low1);
+        }
+    };
+}
+
 RaidGenerator::RaidGenerator(u32 initialAdvances, u32 maxAdvances, u16 tid, u16 sid, const StateFilter &filter, const Raid &raid) :
     Generator(initialAdvances, maxAdvances, tid, sid, raid.getInfo().getGender(), Method::Null, filter),
     raid(raid)
@@ -37,169 +78,247 @@ std::vector<State> RaidGenerator::generate(u64 seed) const
 
     seed += 0x82A2B175229D6A5B * initialAdvances;
 
-    for (u32 advance = 0; advance <= maxAdvances; advance++, seed += 0x82A2B175229D6A5B)
+    // Shiny values the filter accepts, lets advances be rejected before building a State
+    bool shinyFilter[3];
+    for (u8 i = 0; i < 3; i++)
     {
-        Xoroshiro rng(seed);
-        State result(initialAdvances + advance);
+        State state;
+        state.setShiny(i);
+        shinyFilter[i] = filter.compareShiny(state);
+    }
 
-        u32 ec = rng.nextInt<0xffffffff>();
-        // result.setEC(ec);
+    u64 total = static_cast<u64>(maxAdvances) + 1;
+    u64 advance = 0;
+
+    // Only a random shiny chance with a shiny filter rejects advances early enough for the vector path to pay off
+    if (raid.getShinyType() == 0 && !(shinyFilter[0] && shinyFilter[1] && shinyFilter[2]))
+    {
+        const vuint32x4 zero = v32x4_set(0);
+        const vuint32x4 one = v32x4_set(1);
+        const vuint32x4 two = v32x4_set(2);
+        const vuint32x4 full = v32x4_set(0xffffffff);
+        const vuint32x4 mask16 = v32x4_set(0xffff);
+        const vuint32x4 shinyPass[3] = { shinyFilter[0] ? full : zero, shinyFilter[1] ? full : zero, shinyFilter[2] ? full : zero };
 
-        u32 sidtid = rng.nextInt<0xffffffff>();
-        u32 pid = rng.nextInt<0xffffffff>();
+        // Each lane advances 4 raid seeds at a time, the 64 bit addition is done on the split halves with the carry
+        constexpr u64 step = 0x82A2B175229D6A5B * 4;
+        const vuint32x4 stepHigh = v32x4_set(step >> 32);
+        const vuint32x4 stepLow = v32x4_set(step & 0xffffffff);
+
+        u64 seeds[4];
+        for (u8 i = 0; i < 4; i++)
+        {
+            seeds[i] = seed + 0x82A2B175229D6A5B * i;
+        }
+        vuint32x4 high = v32x4_set(seeds[0] >> 32, seeds[1] >> 32, seeds[2] >> 32, seeds[3] >> 32);
+        vuint32x4 low = v32x4_set(seeds[0] & 0xffffffff, seeds[1] & 0xffffffff, seeds[2] & 0xffffffff, seeds[3] & 0xffffffff);
 
-        if (raid.getShinyType() == 0) // Random shiny chance
+        for (; total - advance >= 4; advance += 4)
         {
+            XoroshiroX4 rng { high, low, v32x4_set(0x82A2B175), v32x4_set(0x229D6A5B) };
+
+            vuint32x4 ec = rng.next();
+            vuint32x4 sidtid = rng.next();
+            vuint32x4 pid = rng.peek();
+
             // Game uses a fake TID/SID to determine shiny or not
-            // PID is later modified using the actual TID/SID of trainer if necessary
-            u16 fakeXor = (sidtid >> 16) ^ (sidtid & 0xffff) ^ (pid >> 16) ^ (pid & 0xffff);
-            u16 psv = ((pid >> 16) ^ (pid & 0xffff)) >> 4;
-            u16 realXor = (pid >> 16) ^ (pid & 0xffff) ^ tid ^ sid;
+            vuint32x4 pidXor = v32x4_xor(v32x4_shr<16>(pid), v32x4_and(pid, mask16));
+            vuint32x4 fakeXor = v32x4_xor(v32x4_xor(v32x4_shr<16>(sidtid), v32x4_and(sidtid, mask16)), pidXor);
+            vuint32x4 shiny = v32x4_and(v32x4_cmpgt(v32x4_set(16), fakeXor), v32x4_add(one, v32x4_and(v32x4_cmpeq(fakeXor, zero), one)));
+
+            vuint32x4 pass = v32x4_and(v32x4_cmpeq(shiny, zero), shinyPass[0]);
+            pass = v32x4_or(pass, v32x4_and(v32x4_cmpeq(shiny, one), shinyPass[1]));
+            pass = v32x4_or(pass, v32x4_and(v32x4_cmpeq(shiny, two), shinyPass[2]));
+
+            // nextInt<0xffffffff> rerolls 0xffffffff, those rare lanes go through the scalar path
+            pass = v32x4_or(pass, v32x4_cmpeq(ec, full));
+            pass = v32x4_or(pass, v32x4_cmpeq(sidtid, full));
+            pass = v32x4_or(pass, v32x4_cmpeq(pid, full));
 
-            if (fakeXor < 16) // Force shiny
+            int mask = v32x4_movemask(pass);
+            for (u8 i = 0; mask != 0; i++, mask >>= 1)
             {
-                u8 shinyType = fakeXor == 0 ? 2 : 1;
-                result.setShiny(shinyType);
-                if (fakeXor != realXor)
+                if (mask & 1)
                 {
-                    u16 high = (pid & 0xFFFF) ^ tid ^ sid ^ (2 - shinyType);
-                    pid = (high << 16) | (pid & 0xFFFF);
+                    generate(seed + 0x82A2B175229D6A5B * (advance + i), advance + i, tsv, states);
                 }
             }
-            else // Force non shiny
+
+            vuint32x4 next = v32x4_add(low, stepLow);
+            vuint32x4 carry = v32x4_shr<31>(v32x4_or(v32x4_and(low, stepLow), v32x4_and(v32x4_or(low, stepLow), v32x4_xor(next, full))));
+            high = v32x4_add(v32x4_add(high, stepHigh), carry);
+            low = next;
+        }
+    }
+
+    for (; advance < total; advance++)
+    {
+        generate(seed + 0x82A2B175229D6A5B * advance, advance, tsv, states);
+    }
+
+    return states;
+}
+
+void RaidGenerator::generate(u64 seed, u32 advance, u16 tsv, std::vector<State> &states) const
+{
+    Xoroshiro rng(seed);
+    State result(initialAdvances + advance);
+
+    u32 ec = rng.nextInt<0xffffffff>();
+    // result.setEC(ec);
+
+    u32 sidtid = rng.nextInt<0xffffffff>();
+    u32 pid = rng.nextInt<0xffffffff>();
+
+    if (raid.getShinyType() == 0) // Random shiny chance
+    {
+        // Game uses a fake TID/SID to determine shiny or not
+        // PID is later modified using the actual TID/SID of trainer if necessary
+        u16 fakeXor = (sidtid >> 16) ^ (sidtid & 0xffff) ^ (pid >> 16) ^ (pid & 0xffff);
+        u16 psv = ((pid >> 16) ^ (pid & 0xffff)) >> 4;
+        u16 realXor = (pid >> 16) ^ (pid & 0xffff) ^ tid ^ sid;
+
+        if (fakeXor < 16) // Force shiny
+        {
+            u8 shinyType = fakeXor == 0 ? 2 : 1;
+            result.setShiny(shinyType);
+            if (fakeXor != realXor)
             {
-                result.setShiny(0);
-                if (psv == tsv)
-                {
-                    pid ^= 0x10000000;
-                }
+                u16 high = (pid & 0xFFFF) ^ tid ^ sid ^ (2 - shinyType);
+                pid = (high << 16) | (pid & 0xFFFF);
             }
         }
-        else if (raid.getShinyType() == 1) // Force non-shiny
+        else // Force non shiny
         {
             result.setShiny(0);
-            u16 psv = ((pid >> 16) ^ (pid & 0xffff)) >> 4;
             if (psv == tsv)
             {
                 pid ^= 0x10000000;
             }
         }
-        else // Force shiny
+    }
+    else if (raid.getShinyType() == 1) // Force non-shiny
+    {
+        result.setShiny(0);
+        u16 psv = ((pid >> 16) ^ (pid & 0xffff)) >> 4;
+        if (psv == tsv)
         {
-            result.setShiny(2);
-            u16 realXor = (pid >> 16) ^ (pid & 0xffff) ^ tid ^ sid;
-            if (realXor) // Check if PID is not normally square shiny
-            {
-                // Force shiny (makes it square)
-                u16 high = (pid & 0xffff) ^ tid ^ sid;
-                pid = (high << 16) | (pid & 0xffff);
-            }
+            pid ^= 0x10000000;
         }
-        result.setPID(pid);
-
-        // Early shiny filter reduces further computation
-        if (!filter.compareShiny(result))
+    }
+    else // Force shiny
+    {
+        result.setShiny(2);
+        u16 realXor = (pid >> 16) ^ (pid & 0xffff) ^ tid ^ sid;
+        if (realXor) // Check if PID is not normally square shiny
         {
-            continue;
+            // Force shiny (makes it square)
+            u16 high = (pid & 0xffff) ^ tid ^ sid;
+            pid = (high << 16) | (pid & 0xffff);
         }
+    }
+    result.setPID(pid);
 
-        // Null-out ivs
-        for (u8 i = 0; i < 6; i++)
-        {
-            result.setIV(i, 255);
-        }
+    // Early shiny filter reduces further computation
+    if (!filter.compareShiny(result))
+    {
+        return;
+    }
 
-        // Set IVs that will be 31s
-        for (u8 i = 0; i < raid.getIVCount();)
-        {
-            u8 index = rng.nextInt<6>();
-            if (result.getIV(index) == 255)
-            {
-                result.setIV(index, 31);
-                i++;
-            }
-        }
+    // Null-out ivs
+    for (u8 i = 0; i < 6; i++)
+    {
+        result.setIV(i, 255);
+    }
 
-        // Fill rest of IVs with rand calls
-        for (u8 i = 0; i < 6; i++)
+    // Set IVs that will be 31s
+    for (u8 i = 0; i < raid.getIVCount();)
+    {
+        u8 index = rng.nextInt<6>();
+        if (result.getIV(index) == 255)
         {
-            if (result.getIV(i) == 255)
-            {
-                result.setIV(i, rng.nextInt<32>());
-            }
+            result.setIV(index, 31);
+            i++;
         }
+    }
 
-        if (raid.getAbility() == 4) // Allow hidden ability
-        {
-            result.setAbility(rng.nextInt<3>());
-        }
-        else if (raid.getAbility() == 3) // No hidden ability
-        {
-            result.setAbility(rng.nextInt<2>());
-        }
-        else // Locked ability
+    // Fill rest of IVs with rand calls
+    for (u8 i = 0; i < 6; i++)
+    {
+        if (result.getIV(i) == 255)
         {
-            result.setAbility(raid.getAbility());
+            result.setIV(i, rng.nextInt<32>());
         }
+    }
 
-        // Altform, doesn't seem to have a rand call for raids
+    if (raid.getAbility() == 4) // Allow hidden ability
+    {
+        result.setAbility(rng.nextInt<3>());
+    }
+    else if (raid.getAbility() == 3) // No hidden ability
+    {
+        result.setAbility(rng.nextInt<2>());
+    }
+    else // Locked ability
+    {
+        result.setAbility(raid.getAbility());
+    }
+
+    // Altform, doesn't seem to have a rand call for raids
 
-        if (raid.getGender() == 0) // Random
+    if (raid.getGender() == 0) // Random
+    {
+        if (genderRatio == 255) // Locked genderless
         {
-            if (genderRatio == 255) // Locked genderless
-            {
-                result.setGender(2);
-            }
-            else if (genderRatio == 254) // Locked female
-            {
-                result.setGender(1);
-            }
-            else if (genderRatio == 0) // Locked male
-            {
-                result.setGender(0);
-            }
-            else // Random
-            {
-                result.setGender((rng.nextInt<253>() + 1) < genderRatio);
-            }
+            result.setGender(2);
         }
-        else if (raid.getGender() == 1) // Male
+        else if (genderRatio == 254) // Locked female
         {
-            result.setGender(0);
+            result.setGender(1);
         }
-        else if (raid.getGender() == 2) // Female
+        else if (genderRatio == 0) // Locked male
         {
-            result.setGender(1);
+            result.setGender(0);
         }
-        else if (raid.getGender() == 3) // Genderless
+        else // Random
         {
-            result.setGender(2);
+            result.setGender((rng.nextInt<253>() + 1) < genderRatio);
         }
+    }
+    else if (raid.getGender() == 1) // Male
+    {
+        result.setGender(0);
+    }
+    else if (raid.getGender() == 2) // Female
+    {
+        result.setGender(1);
+    }
+    else if (raid.getGender() == 3) // Genderless
+    {
+        result.setGender(2);
+    }
 
-        if (raid.getSpecies() != 849)
+    if (raid.getSpecies() != 849)
+    {
+        result.setNature(rng.nextInt<25>());
+    }
+    else
+    {
+        if (raid.getSpecies() == 0)
         {
-            result.setNature(rng.nextInt<25>());
+            result.setNature(toxtricityAmpedNatures[rng.nextInt<13>()]);
         }
         else
         {
-            if (raid.getSpecies() == 0)
-            {
-                result.setNature(toxtricityAmpedNatures[rng.nextInt<13>()]);
-            }
-            else
-            {
-                result.setNature(toxtricityLowKeyNatures[rng.nextInt<12>()]);
-            }
+            result.setNature(toxtricityLowKeyNatures[rng.nextInt<12>()]);
         }
+    }
 
-        // Height (2 calls)
-        // Weight (2 calls)
+    // Height (2 calls)
+    // Weight (2 calls)
 
-        if (filter.comparePID(result) && filter.compareIV(result))
-        {
-            states.emplace_back(result);
-        }
+    if (filter.comparePID(result) && filter.compareIV(result))
+    {
+        states.emplace_back(result);
     }
-
-    return states;
 }
@@ -32,6 +32,8 @@ public:
 
 private:
     Raid raid;
+
+    void generate(u64 seed, u32 advance, u16 tsv, std::vector<State> &states) const;
 };
 
 #endif // RAIDGENERATOR_HPP
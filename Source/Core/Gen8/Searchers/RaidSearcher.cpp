@@ -0,0 +1,423 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "RaidSearcher.hpp"
+#include <Core/Gen8/Generators/RaidGenerator.hpp>
+#include <Core/Parents/Filters/StateFilter.hpp>
+#include <Core/RNG/Xoroshiro.hpp>
+#include <algorithm>
+#include <array>
+#include <future>
+
+namespace
+{
+    constexpr u64 xoroshiroConstant = 0x82A2B175229D6A5B;
+
+    // Every bit of a Xoroshiro state half as an affine function of the 64 bits of the raid seed
+    struct Affine
+    {
+        std::array<u64, 64> masks;
+        u64 constant;
+    };
+
+    Affine operator^(const Affine &left, const Affine &right)
+    {
+        Affine result;
+        for (u8 i = 0; i < 64; i++)
+        {
+            result.masks[i] = left.masks[i] ^ right.masks[i];
+        }
+        result.constant = left.constant ^ right.constant;
+        return result;
+    }
+
+    Affine rotl(const Affine &x, u8 k)
+    {
+        Affine result;
+        for (u8 i = 0; i < 64; i++)
+        {
+            result.masks[(i + k) & 63] = x.masks[i];
+        }
+        result.constant = (x.constant << k) | (x.constant >> (64 - k));
+        return result;
+    }
+
+    Affine shl(const Affine &x, u8 k)
+    {
+        Affine result;
+        for (u8 i = 0; i < 64; i++)
+        {
+            result.masks[i] = i < k ? 0 : x.masks[i - k];
+        }
+        result.constant = x.constant << k;
+        return result;
+    }
+
+    // Both state halves before each of the first 3 outputs (EC, fake TID/SID, PID)
+    const std::array<std::pair<Affine, Affine>, 3> &getStates()
+    {
+        static const std::array<std::pair<Affine, Affine>, 3> states = [] {
+            std::array<std::pair<Affine, Affine>, 3> states;
+
+            Affine s0;
+            Affine s1;
+            for (u8 i = 0; i < 64; i++)
+            {
+                s0.masks[i] = 1ULL << i;
+                s1.masks[i] = 0;
+            }
+            s0.constant = 0;
+            s1.constant = xoroshiroConstant;
+
+            for (u8 i = 0; i < 3; i++)
+            {
+                states[i] = std::make_pair(s0, s1);
+
+                s1 = s1 ^ s0;
+                s0 = rotl(s0, 24) ^ s1 ^ shl(s1, 16);
+                s1 = rotl(s1, 37);
+            }
+
+            return states;
+        }();
+        return states;
+    }
+
+    u8 parity(u64 x)
+    {
+        x ^= x >> 32;
+        x ^= x >> 16;
+        x ^= x >> 8;
+        x ^= x >> 4;
+        x ^= x >> 2;
+        x ^= x >> 1;
+        return x & 1;
+    }
+
+    // Linear system over GF(2) in the 64 seed bits, each row has its pivot as its lowest set bit
+    class Equations
+    {
+    public:
+        // Adds parity(mask & seed) == value, returns false if it contradicts the existing rows
+        bool add(u64 mask, u8 value)
+        {
+            reduce(mask, value);
+            if (mask == 0)
+            {
+                return value == 0;
+            }
+
+            u8 pivot = 0;
+            while (((mask >> pivot) & 1) == 0)
+            {
+                pivot++;
+            }
+
+            rows[pivot] = mask;
+            values |= static_cast<u64>(value) << pivot;
+            pivots |= 1ULL << pivot;
+            return true;
+        }
+
+        // Value of parity(mask & seed) ^ constant, or 2 if the rows don't determine it yet
+        u8 evaluate(u64 mask, u8 constant) const
+        {
+            reduce(mask, constant);
+            return mask == 0 ? constant : 2;
+        }
+
+        void solve(std::vector<u64> &seeds) const
+        {
+            u64 free = ~pivots;
+            u64 count = 1ULL << (64 - popcount(pivots));
+            for (u64 i = 0; i < count; i++)
+            {
+                // Spread the counter over the free bits, then back substitute the pivots from the top down
+                u64 seed = 0;
+                u64 bits = i;
+                for (u8 bit = 0; bit < 64 && bits != 0; bit++)
+                {
+                    if ((free >> bit) & 1)
+                    {
+                        seed |= (bits & 1) << bit;
+                        bits >>= 1;
+                    }
+                }
+
+                for (int pivot = 63; pivot >= 0; pivot--)
+                {
+                    if ((pivots >> pivot) & 1)
+                    {
+                        u64 value = ((values >> pivot) & 1) ^ parity(rows[pivot] & seed);
+                        seed |= value << pivot;
+                    }
+                }
+
+                seeds.emplace_back(seed);
+            }
+        }
+
+    private:
+        std::array<u64, 64> rows {};
+        u64 values = 0;
+        u64 pivots = 0;
+
+        void reduce(u64 &mask, u8 &value) const
+        {
+            for (u8 bit = 0; bit < 64 && mask != 0; bit++)
+            {
+                if (((mask & pivots) >> bit) & 1)
+                {
+                    mask ^= rows[bit];
+                    value ^= (values >> bit) & 1;
+                }
+            }
+        }
+
+        static u8 popcount(u64 x)
+        {
+            u8 count = 0;
+            for (; x != 0; x &= x - 1)
+            {
+                count++;
+            }
+            return count;
+        }
+    };
+
+    // One known bit of the sum of the two state halves
+    struct SumBit
+    {
+        u64 maskA;
+        u64 maskB;
+        u8 constantA;
+        u8 constantB;
+        u8 value;
+        bool first;
+        bool last;
+    };
+
+    void addSumBits(std::vector<SumBit> &bits, const std::pair<Affine, Affine> &state, u32 value, u8 count)
+    {
+        for (u8 i = 0; i < count; i++)
+        {
+            bits.emplace_back(SumBit { state.first.masks[i], state.second.masks[i], static_cast<u8>((state.first.constant >> i) & 1),
+                                       static_cast<u8>((state.second.constant >> i) & 1), static_cast<u8>((value >> i) & 1), i == 0,
+                                       i == count - 1 });
+        }
+    }
+
+    // Walks the known bits from the lowest up tracking the carry of the addition
+    // Whenever the carry depends on a state bit the system doesn't determine yet both values are tried
+    void solveBits(const std::vector<SumBit> &bits, size_t index, u8 carry, const Equations &equations, std::vector<u64> &seeds)
+    {
+        if (index == bits.size())
+        {
+            equations.solve(seeds);
+            return;
+        }
+
+        const SumBit &bit = bits[index];
+        if (bit.first)
+        {
+            carry = 0;
+        }
+
+        Equations next = equations;
+        if (!next.add(bit.maskA ^ bit.maskB, bit.value ^ carry ^ bit.constantA ^ bit.constantB))
+        {
+            return;
+        }
+
+        if (bit.last)
+        {
+            solveBits(bits, index + 1, 0, next, seeds);
+            return;
+        }
+
+        u8 a = next.evaluate(bit.maskA, bit.constantA);
+        for (u8 guess = 0; guess < 2; guess++)
+        {
+            if (a != 2 && a != guess)
+            {
+                continue;
+            }
+
+            Equations branch = next;
+            if (a == 2)
+            {
+                branch.add(bit.maskA, guess ^ bit.constantA);
+            }
+
+            u8 b = guess ^ bit.value ^ carry;
+            solveBits(bits, index + 1, (guess & b) | (carry & (guess ^ b)), branch, seeds);
+        }
+    }
+}
+
+RaidSearcher::RaidSearcher(u16 tid, u16 sid, const std::vector<Raid> &raids, const std::vector<u32> &ecs,
+                           const std::vector<State> &states) :
+    raids(raids), ecs(ecs), states(states), tid(tid), sid(sid), searching(false), progress(0)
+{
+}
+
+void RaidSearcher::startSearch(int threads)
+{
+    searching = true;
+
+    auto candidates = getCandidates();
+
+    if (threads < 1)
+    {
+        threads = 1;
+    }
+    else if (static_cast<size_t>(threads) > candidates.size())
+    {
+        threads = std::max(static_cast<int>(candidates.size()), 1);
+    }
+
+    std::vector<std::future<void>> threadContainer;
+
+    size_t split = candidates.size() / threads;
+    size_t start = 0;
+    for (int i = 0; i < threads; i++)
+    {
+        size_t end = i == threads - 1 ? candidates.size() : start + split;
+        threadContainer.emplace_back(std::async(std::launch::async, [=, &candidates] { search(candidates, start, end); }));
+        start += split;
+    }
+
+    for (int i = 0; i < threads; i++)
+    {
+        threadContainer[i].wait();
+    }
+
+    std::sort(results.begin(), results.end());
+}
+
+void RaidSearcher::cancelSearch()
+{
+    searching = false;
+}
+
+std::vector<u64> RaidSearcher::getResults()
+{
+    std::lock_guard<std::mutex> guard(mutex);
+    auto data = std::move(results);
+    return data;
+}
+
+int RaidSearcher::getProgress() const
+{
+    return progress;
+}
+
+std::vector<u64> RaidSearcher::getCandidates() const
+{
+    std::vector<u64> candidates;
+    if (raids.empty() || raids.size() != ecs.size() || raids.size() != states.size())
+    {
+        return candidates;
+    }
+
+    // The low 16 bits of the PID are never modified, the upper bits only by a forced shiny
+    // A non-shiny PID can have bit 28 flipped, so the 28 bits below it are still the RNG output
+    u8 best = 0;
+    u8 bestBits = 0;
+    for (u8 i = 0; i < states.size(); i++)
+    {
+        u32 pid = states[i].getPID();
+        u16 shinyXor = (pid >> 16) ^ (pid & 0xffff) ^ tid ^ sid;
+        u8 bits = shinyXor < 16 ? 16 : 28;
+        if (bits > bestBits)
+        {
+            best = i;
+            bestBits = bits;
+        }
+    }
+
+    // Raid i of a den uses the seed advanced i days, solve for the raid with the most known bits and step back from it
+    const auto &xoroshiroStates = getStates();
+    std::vector<SumBit> bits;
+    addSumBits(bits, xoroshiroStates[0], ecs[best], 32);
+    addSumBits(bits, xoroshiroStates[2], states[best].getPID(), bestBits);
+
+    solveBits(bits, 0, 0, Equations(), candidates);
+
+    for (u64 &candidate : candidates)
+    {
+        candidate -= xoroshiroConstant * best;
+    }
+
+    return candidates;
+}
+
+void RaidSearcher::search(const std::vector<u64> &candidates, size_t start, size_t end)
+{
+    std::vector<RaidGenerator> generators;
+    for (u8 i = 0; i < raids.size(); i++)
+    {
+        const State &state = states[i];
+
+        std::array<u8, 6> ivs;
+        for (u8 j = 0; j < 6; j++)
+        {
+            ivs[j] = state.getIV(j);
+        }
+
+        std::vector<bool> natures(25, false);
+        natures[state.getNature()] = true;
+
+        StateFilter filter(state.getGender(), state.getAbility(), 255, false, ivs, ivs, natures, std::vector<bool>(16, true), {});
+        generators.emplace_back(i, 0, tid, sid, filter, raids[i]);
+    }
+
+    for (size_t i = start; i < end; i++)
+    {
+        if (!searching)
+        {
+            return;
+        }
+
+        u64 seed = candidates[i];
+
+        bool valid = true;
+        for (u8 j = 0; j < raids.size() && valid; j++)
+        {
+            Xoroshiro rng(seed + xoroshiroConstant * j);
+            if (rng.nextInt<0xffffffff>() != ecs[j])
+            {
+                valid = false;
+                continue;
+            }
+
+            auto generated = generators[j].generate(seed);
+            valid = std::any_of(generated.begin(), generated.end(),
+                                [this, j](const State &state) { return state.getPID() == states[j].getPID(); });
+        }
+
+        if (valid)
+        {
+            std::lock_guard<std::mutex> guard(mutex);
+            results.emplace_back(seed);
+        }
+
+        progress++;
+    }
+}
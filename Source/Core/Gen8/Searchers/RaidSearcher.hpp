@@ -0,0 +1,54 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef RAIDSEARCHER_HPP
+#define RAIDSEARCHER_HPP
+
+#include <Core/Gen8/Raid.hpp>
+#include <Core/Parents/States/State.hpp>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+class RaidSearcher
+{
+public:
+    RaidSearcher(u16 tid, u16 sid, const std::vector<Raid> &raids, const std::vector<u32> &ecs, const std::vector<State> &states);
+    void startSearch(int threads);
+    void cancelSearch();
+    std::vector<u64> getResults();
+    int getProgress() const;
+
+private:
+    std::vector<Raid> raids;
+    std::vector<u32> ecs;
+    std::vector<State> states;
+    u16 tid;
+    u16 sid;
+
+    bool searching;
+    std::atomic<u32> progress;
+    std::vector<u64> results;
+    std::mutex mutex;
+
+    std::vector<u64> getCandidates() const;
+    void search(const std::vector<u64> &candidates, size_t start, size_t end);
+};
+
+#endif // RAIDSEARCHER_HPP
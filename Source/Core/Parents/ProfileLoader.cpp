@@ -28,25 +28,45 @@ using json = nlohmann::json;
 namespace
 {
     std::string path;
+    json document;
 
-    json readJson()
+    // The file is parsed once by ProfileLoader::init and every change is applied to the copy held in memory
+    json &readJson()
     {
-        json j;
+        return document;
+    }
 
-        std::ifstream read(path);
-        if (read.is_open())
-        {
-            j = json::parse(read, nullptr, false);
-        }
+    const json &readJson(const std::string &gen)
+    {
+        static const json empty = json::array();
 
-        return j.is_discarded() ? json() : j;
+        auto it = document.find(gen);
+        return it == document.end() ? empty : *it;
     }
 
-    void writeJson(const json &j)
+    void writeJson()
     {
-        std::ofstream write(path);
-        write << j.dump();
+        // Write to a temporary file and rename it over the original so a crash can't leave a truncated profile file behind
+        std::string temp = path + ".tmp";
+        std::error_code error;
+
+        std::ofstream write(temp);
+        write << document.dump();
+        write.flush();
         write.close();
+
+        // Errors such as a full disk only show up once the buffer is written out
+        if (!write)
+        {
+            std::filesystem::remove(temp, error);
+            return;
+        }
+
+        std::filesystem::rename(temp, path, error);
+        if (error)
+        {
+            std::filesystem::remove(temp, error);
+        }
     }
 }
 
@@ -55,13 +75,24 @@ namespace ProfileLoader
     bool init(const std::string &location)
     {
         path = location;
+        document = json::object();
 
         bool exists = std::filesystem::exists(path);
-        if (!exists)
+        if (exists)
+        {
+            std::ifstream read(path);
+            if (read.is_open())
+            {
+                json j = json::parse(read, nullptr, false);
+                if (!j.is_discarded())
+                {
+                    document = std::move(j);
+                }
+            }
+        }
+        else
         {
-            std::ofstream json(path);
-            json << "{}";
-            json.close();
+            writeJson();
         }
 
         return exists;
@@ -99,8 +130,7 @@ namespace ProfileLoader3
     {
         std::vector<Profile3> profiles;
 
-        json j = readJson();
-        const auto &gen3 = j["gen3"];
+        const auto &gen3 = readJson("gen3");
         std::transform(gen3.begin(), gen3.end(), std::back_inserter(profiles), [](const json &j) { return getProfile(j); });
 
         return profiles;
@@ -108,17 +138,17 @@ namespace ProfileLoader3
 
     void addProfile(const Profile3 &profile)
     {
-        json j = readJson();
+        json &j = readJson();
 
         auto &gen3 = j["gen3"];
         gen3.emplace_back(getJson(profile));
 
-        writeJson(j);
+        writeJson();
     }
 
     void removeProfile(const Profile3 &remove)
     {
-        json j = readJson();
+        json &j = readJson();
 
         auto &gen3 = j["gen3"];
         for (size_t i = 0; i < gen3.size(); i++)
@@ -129,7 +159,7 @@ namespace ProfileLoader3
             {
                 gen3.erase(gen3.begin() + i);
 
-                writeJson(j);
+                writeJson();
                 break;
             }
         }
@@ -137,7 +167,7 @@ namespace ProfileLoader3
 
     void updateProfile(const Profile3 &update, const Profile3 &original)
     {
-        json j = readJson();
+        json &j = readJson();
 
         auto &gen3 = j["gen3"];
         for (auto &i : gen3)
@@ -148,7 +178,7 @@ namespace ProfileLoader3
             {
                 i = getJson(update);
 
-                writeJson(j);
+                writeJson();
                 break;
             }
         }
@@ -192,8 +222,7 @@ namespace ProfileLoader4
     {
         std::vector<Profile4> profiles;
 
-        json j = readJson();
-        const auto &gen4 = j["gen4"];
+        const auto &gen4 = readJson("gen4");
         std::transform(gen4.begin(), gen4.end(), std::back_inserter(profiles), [](const json &j) { return getProfile(j); });
 
         return profiles;
@@ -201,17 +230,17 @@ namespace ProfileLoader4
 
     void addProfile(const Profile4 &profile)
     {
-        json j = readJson();
+        json &j = readJson();
 
         auto &gen4 = j["gen4"];
         gen4.emplace_back(getJson(profile));
 
-        writeJson(j);
+        writeJson();
     }
 
     void removeProfile(const Profile4 &remove)
     {
-        json j = readJson();
+        json &j = readJson();
 
         auto &gen4 = j["gen4"];
         for (size_t i = 0; i < gen4.size(); i++)
@@ -222,7 +251,7 @@ namespace ProfileLoader4
             {
                 gen4.erase(gen4.begin() + i);
 
-                writeJson(j);
+                writeJson();
                 break;
             }
         }
@@ -230,7 +259,7 @@ namespace ProfileLoader4
 
     void updateProfile(const Profile4 &update, const Profile4 &original)
     {
-        json j = readJson();
+        json &j = readJson();
 
         auto &gen4 = j["gen4"];
         for (auto &i : gen4)
@@ -241,7 +270,7 @@ namespace ProfileLoader4
             {
                 i = getJson(update);
 
-                writeJson(j);
+                writeJson();
                 break;
             }
         }
@@ -305,8 +334,7 @@ namespace ProfileLoader5
     {
         std::vector<Profile5> profiles;
 
-        json j = readJson();
-        const auto &gen5 = j["gen5"];
+        const auto &gen5 = readJson("gen5");
         std::transform(gen5.begin(), gen5.end(), std::back_inserter(profiles), [](const json &j) { return getProfile(j); });
 
         return profiles;
@@ -314,17 +342,17 @@ namespace ProfileLoader5
 
     void addProfile(const Profile5 &profile)
     {
-        json j = readJson();
+        json &j = readJson();
 
         auto &gen5 = j["gen5"];
         gen5.emplace_back(getJson(profile));
 
-        writeJson(j);
+        writeJson();
     }
 
     void removeProfile(const Profile5 &remove)
     {
-        json j = readJson();
+        json &j = readJson();
 
         auto &gen5 = j["gen5"];
         for (size_t i = 0; i < gen5.size(); i++)
@@ -335,7 +363,7 @@ namespace ProfileLoader5
             {
                 gen5.erase(gen5.begin() + i);
 
-                writeJson(j);
+                writeJson();
                 break;
             }
         }
@@ -343,7 +371,7 @@ namespace ProfileLoader5
 
     void updateProfile(const Profile5 &update, const Profile5 &original)
     {
-        json j = readJson();
+        json &j = readJson();
 
         auto &gen5 = j["gen5"];
         for (auto &i : gen5)
@@ -354,7 +382,7 @@ namespace ProfileLoader5
             {
                 i = getJson(update);
 
-                writeJson(j);
+                writeJson();
                 break;
             }
         }
@@ -392,8 +420,7 @@ namespace ProfileLoader8
     {
         std::vector<Profile8> profiles;
 
-        json j = readJson();
-        const auto &gen8 = j["gen8"];
+        const auto &gen8 = readJson("gen8");
         std::transform(gen8.begin(), gen8.end(), std::back_inserter(profiles), [](const json &j) { return getProfile(j); });
 
         return profiles;
@@ -401,17 +428,17 @@ namespace ProfileLoader8
 
     void addProfile(const Profile8 &profile)
     {
-        json j = readJson();
+        json &j = readJson();
 
         auto &gen8 = j["gen8"];
         gen8.emplace_back(getJson(profile));
 
-        writeJson(j);
+        writeJson();
     }
 
     void removeProfile(const Profile8 &remove)
     {
-        json j = readJson();
+        json &j = readJson();
 
         auto &gen8 = j["gen8"];
         for (size_t i = 0; i < gen8.size(); i++)
@@ -422,7 +449,7 @@ namespace ProfileLoader8
             {
                 gen8.erase(gen8.begin() + i);
 
-                writeJson(j);
+                writeJson();
                 break;
             }
         }
@@ -430,7 +457,7 @@ namespace ProfileLoader8
 
     void updateProfile(const Profile8 &update, const Profile8 &original)
     {
-        json j = readJson();
+        json &j = readJson();
 
         auto &gen8 = j["gen8"];
         for (auto &i : gen8)
@@ -441,7 +468,7 @@ namespace ProfileLoader8
             {
                 i = getJson(update);
 
-                writeJson(j);
+                writeJson();
                 break;
             }
         }
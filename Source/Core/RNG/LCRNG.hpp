@@ -49,6 +49,30 @@ public:
         return prng;
     }
 
+    // Advancing 2^i times flips bit i of the seed and leaves the lower bits untouched
+    // This allows the number of advances between two seeds to be recovered one bit at a time
+    static u32 distance(u32 start, u32 end)
+    {
+        u32 advances = 0;
+        u32 jumpMult = mult;
+        u32 jumpAdd = add;
+
+        for (u8 i = 0; i < 32; i++)
+        {
+            u32 bit = 1U << i;
+            if ((start ^ end) & bit)
+            {
+                start = start * jumpMult + jumpAdd;
+                advances |= bit;
+            }
+
+            jumpAdd *= jumpMult + 1;
+            jumpMult *= jumpMult;
+        }
+
+        return advances;
+    }
+
     template <bool flag = false>
     u32 next()
     {
@@ -19,102 +19,153 @@
 
 #include "RNGCache.hpp"
 #include <Core/Enum/Method.hpp>
-#include <cstring>
+#include <algorithm>
 
-// See https://crypto.stackexchange.com/a/10609 for how the following math works
-// Uses a brute force meet in the middle attack using precomputated data
+namespace
+{
+    // Lookups return at most maxSeeds entries, an insertion sort also avoids GCC flagging the 16 element branch of std::sort
+    template <class Compare>
+    void sortSeeds(std::array<u32, RNGCache::maxSeeds> &seeds, u8 size, Compare compare)
+    {
+        for (u8 i = 1; i < size; i++)
+        {
+            u32 seed = seeds[i];
+            u8 j = i;
+            for (; j > 0 && compare(seed, seeds[j - 1]); j--)
+            {
+                seeds[j] = seeds[j - 1];
+            }
+            seeds[j] = seed;
+        }
+    }
+}
 
-RNGCache::RNGCache(Method method)
+// For a seed with known upper 16 bits the next call only depends on the upper 16 bits of low * mult
+// Grouping every low by those bits (minus the top bit which is unknown for IVs) turns the search into
+// two bucket lookups, one for each possible carry out of the lower 16 bits
+
+struct RNGCache::Table
 {
-    if (method == Method::Method4 || method == Method::MethodH4)
+    Table(u32 mult, u32 add) : mult(mult), add(add)
     {
-        k = 0xa29a6900; // Mult * Mult << 8
-        mult = 0xc2a29a69; // Mult * Mult
-        add = 0xe97e7b6a; // Add * (Mult + 1)
+        offsets.fill(0);
+        for (u32 low = 0; low < 0x10000; low++)
+        {
+            offsets[getKey(low) + 1]++;
+        }
+
+        for (size_t i = 1; i < offsets.size(); i++)
+        {
+            offsets[i] += offsets[i - 1];
+        }
+
+        auto position = offsets;
+        for (u32 low = 0; low < 0x10000; low++)
+        {
+            lows[position[getKey(low)]++] = static_cast<u16>(low);
+        }
     }
-    // Method 1/2
-    else
+
+    u16 getKey(u32 low) const
     {
-        k = 0xc64e6d00; // Mult << 8
-        mult = 0x41c64e6d; // pokerng constant
-        add = 0x6073; // pokerng constant
+        return ((low * mult) >> 16) & 0x7fff;
     }
 
-    std::memset(low, 0, sizeof(low));
-    std::memset(flags, false, sizeof(flags));
-    for (u16 i = 0; i < 256; i++)
+    // Appends every low that makes first | low produce second under mask
+    u8 search(u32 first, u32 second, u32 mask, std::array<u32, maxSeeds> &seeds) const
     {
-        u32 right = mult * i + add;
-        u16 val = right >> 16;
+        u8 size = 0;
+        u32 base = first * mult + add;
 
-        flags[val] = true;
-        low[val--] = static_cast<u8>(i);
-        flags[val] = true;
-        low[val] = static_cast<u8>(i);
+        for (u16 carry = 0; carry < 2; carry++)
+        {
+            u16 key = ((second >> 16) - (base >> 16) - carry) & 0x7fff;
+            for (u32 i = offsets[key]; i < offsets[key + 1]; i++)
+            {
+                u32 test = first | lows[i];
+                if (((test * mult + add) & mask) == second)
+                {
+                    seeds[size++] = test;
+                }
+            }
+        }
+
+        return size;
+    }
+
+    u32 mult;
+    u32 add;
+    std::array<u32, 0x8001> offsets;
+    std::array<u16, 0x10000> lows;
+};
+
+// Tables are only dependent on the method family so they are built once and shared
+RNGCache::RNGCache(Method method)
+{
+    if (method == Method::Method4 || method == Method::MethodH4)
+    {
+        static const Table method4(0xc2a29a69, 0xe97e7b6a); // Mult * Mult, Add * (Mult + 1)
+        table = &method4;
+    }
+    // Method 1/2
+    else
+    {
+        static const Table method12(0x41c64e6d, 0x6073); // pokerng constants
+        table = &method12;
     }
 }
 
 // Recovers origin seeds for two 16 bit calls(15 bits known) with or without gap based on the cache
 std::vector<u32> RNGCache::recoverLower16BitsIV(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const
 {
-    std::vector<u32> origin;
-    origin.reserve(3);
+    std::array<u32, maxSeeds> seeds;
+    u8 size = recoverLower16BitsIV(hp, atk, def, spa, spd, spe, seeds);
+    return std::vector<u32>(seeds.begin(), seeds.begin() + size);
+}
 
+// Same as above but writes into seeds
+// Seeds are ordered by the middle byte of the lower 16 bits and then by the unknown top bit of the second call
+u8 RNGCache::recoverLower16BitsIV(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, std::array<u32, maxSeeds> &seeds) const
+{
     u32 first = static_cast<u32>((hp | (atk << 5) | (def << 10)) << 16);
     u32 second = static_cast<u32>((spe | (spa << 5) | (spd << 10)) << 16);
 
-    // Check with the top bit of the first call both
-    // flipped and unflipped to account for only knowing 15 bits
-    u32 search1 = second - first * mult;
-    u32 search2 = second - (first ^ 0x80000000) * mult;
+    u8 size = table->search(first, second, 0x7fff0000, seeds);
+    sortSeeds(seeds, size, [this](u32 left, u32 right) {
+        u32 leftKey = (left & 0xff00) | ((left * table->mult + table->add) >> 31);
+        u32 rightKey = (right & 0xff00) | ((right * table->mult + table->add) >> 31);
+        return leftKey < rightKey;
+    });
 
-    for (u16 i = 0; i < 256; i++, search1 -= k, search2 -= k)
-    {
-        if (flags[search1 >> 16])
-        {
-            u32 test = first | static_cast<u32>(i << 8) | low[search1 >> 16];
-            // Verify IV calls line up
-            if (((test * mult + add) & 0x7fff0000) == second)
-            {
-                origin.emplace_back(test);
-            }
-        }
+    return size;
+}
 
-        if (flags[search2 >> 16])
-        {
-            u32 test = first | static_cast<u32>(i << 8) | low[search2 >> 16];
-            // Verify IV calls line up
-            if (((test * mult + add) & 0x7fff0000) == second)
-            {
-                origin.emplace_back(test);
-            }
-        }
+// Recovers origin seeds for count IV tuples back to back in seeds which needs room for maxSeeds entries per tuple
+// The number of seeds for each tuple is stored in counts
+size_t RNGCache::recoverLower16BitsIV(const std::array<u8, 6> *ivs, size_t count, u32 *seeds, u8 *counts) const
+{
+    size_t total = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        const auto &iv = ivs[i];
+        std::array<u32, maxSeeds> found;
+        counts[i] = recoverLower16BitsIV(iv[0], iv[1], iv[2], iv[3], iv[4], iv[5], found);
+        std::copy(found.begin(), found.begin() + counts[i], seeds + total);
+        total += counts[i];
     }
-
-    return origin;
+    return total;
 }
 
 // Recovers origin seeds for two 16 bit calls based on the cache
 std::vector<u32> RNGCache::recoverLower16BitsPID(u32 pid) const
 {
-    std::vector<u32> origin;
+    std::array<u32, maxSeeds> seeds;
 
     u32 first = pid << 16;
     u32 second = pid & 0xFFFF0000;
-    u32 search = second - first * mult;
 
-    for (u16 i = 0; i < 256; i++, search -= k)
-    {
-        if (flags[search >> 16])
-        {
-            u32 test = first | static_cast<u32>(i << 8) | low[search >> 16];
-            // Verify PID calls line up
-            if (((test * mult + add) & 0xffff0000) == second)
-            {
-                origin.emplace_back(test);
-            }
-        }
-    }
+    u8 size = table->search(first, second, 0xffff0000, seeds);
+    sortSeeds(seeds, size, [](u32 left, u32 right) { return left < right; });
 
-    return origin;
+    return std::vector<u32>(seeds.begin(), seeds.begin() + size);
 }
@@ -21,6 +21,7 @@
 #define RNGCACHE_HPP
 
 #include <Core/Util/Global.hpp>
+#include <array>
 #include <vector>
 
 enum Method : u8;
@@ -28,17 +29,19 @@ enum Method : u8;
 class RNGCache
 {
 public:
+    // Most seeds a single IV or PID lookup can produce for either multiplier
+    static constexpr u8 maxSeeds = 5;
+
     RNGCache() = default;
     explicit RNGCache(Method method);
     std::vector<u32> recoverLower16BitsIV(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const;
+    u8 recoverLower16BitsIV(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, std::array<u32, maxSeeds> &seeds) const;
+    size_t recoverLower16BitsIV(const std::array<u8, 6> *ivs, size_t count, u32 *seeds, u8 *counts) const;
     std::vector<u32> recoverLower16BitsPID(u32 pid) const;
 
 private:
-    u32 add;
-    u32 k;
-    u32 mult;
-    u8 low[0x10000];
-    bool flags[0x10000];
+    struct Table;
+    const Table *table;
 };
 
 #endif // RNGCACHE_HPP
@@ -19,6 +19,7 @@
 
 #include "RNGEuclidean.hpp"
 #include <Core/RNG/LCRNG.hpp>
+#include <Core/RNG/SIMD.hpp>
 
 // See https://crypto.stackexchange.com/a/10629 for how the following math works
 // Uses Euclidean divison to reduce the search space (kmax) even further then RNGCache
@@ -29,8 +30,15 @@ namespace RNGEuclidean
     // Recovers origin seeds for two 16 bit calls(15 bits known)
     std::vector<std::pair<u32, u32>> recoverLower16BitsIV(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe)
     {
-        std::vector<std::pair<u32, u32>> origin;
-        origin.reserve(3);
+        std::pair<u32, u32> seeds[7];
+        u8 size = recoverLower16BitsIV(hp, atk, def, spa, spd, spe, seeds);
+        return std::vector<std::pair<u32, u32>>(seeds, seeds + size);
+    }
+
+    // Same as above but writes into seeds which needs room for 7 entries (kmax is at most 6)
+    u8 recoverLower16BitsIV(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, std::pair<u32, u32> *seeds)
+    {
+        u8 size = 0;
 
         constexpr u32 sub1 = 0x343fd; // XDRNG mult (>= 2^16)
         constexpr u32 sub2 = 0x259ec4; // (-)XDRNG add + 0x10000 - 1
@@ -48,17 +56,39 @@ namespace RNGEuclidean
             {
                 u32 fullFirst = first | static_cast<u32>(t / sub1);
                 u32 fullSecond = XDRNG(fullFirst).next();
-                origin.emplace_back(fullFirst, fullSecond);
+                seeds[size++] = std::make_pair(fullFirst, fullSecond);
             }
         }
 
-        return origin;
+        return size;
+    }
+
+    // Recovers origin seeds for count IV tuples back to back in seeds which needs room for 7 entries per tuple
+    // The number of seeds for each tuple is stored in counts
+    size_t recoverLower16BitsIV(const std::array<u8, 6> *ivs, size_t count, std::pair<u32, u32> *seeds, u8 *counts)
+    {
+        size_t total = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            const auto &iv = ivs[i];
+            counts[i] = recoverLower16BitsIV(iv[0], iv[1], iv[2], iv[3], iv[4], iv[5], seeds + total);
+            total += counts[i];
+        }
+        return total;
     }
 
     // Recovers origin seeds for two 16 bit calls
     std::vector<std::pair<u32, u32>> recoverLower16BitsPID(u32 pid)
     {
-        std::vector<std::pair<u32, u32>> origin;
+        std::pair<u32, u32> seeds[4];
+        u8 size = recoverLower16BitsPID(pid, seeds);
+        return std::vector<std::pair<u32, u32>>(seeds, seeds + size);
+    }
+
+    // Same as above but writes into seeds which needs room for 4 entries (kmax is at most 3)
+    u8 recoverLower16BitsPID(u32 pid, std::pair<u32, u32> *seeds)
+    {
+        u8 size = 0;
 
         constexpr u32 sub1 = 0x343fd; // XDRNG mult (>= 2^16)
         constexpr u32 sub2 = 0x259ec4; // (-)XDRNG add + 0x10000 - 1
@@ -76,11 +106,11 @@ namespace RNGEuclidean
             {
                 u32 fullFirst = first | static_cast<u32>(t / sub1);
                 u32 fullSecond = XDRNG(fullFirst).next();
-                origin.emplace_back(fullFirst, fullSecond);
+                seeds[size++] = std::make_pair(fullFirst, fullSecond);
             }
         }
 
-        return origin;
+        return size;
     }
 
     // Recovers origin seeds for six 5 bit calls
@@ -104,11 +134,87 @@ namespace RNGEuclidean
         u64 t = (((spd << 27) - sub1 * first) - sub2) & 0xFFFFFFFF;
         u32 kmax = (base - t) >> 32;
 
-        for (u32 k = 0; k <= kmax; k++, t += 0x100000000)
+        // kmax is in the millions so avoid dividing on every step
+        // Each step adds 2^32 to t which adds a fixed amount to both the quotient and remainder
+        // with an extra 1 to the quotient whenever the remainder wraps around the multiplier
+        constexpr u32 step = 0x0E408DB2; // 2^32 % Modified mult
+        constexpr u32 stepQuotient = 6; // 2^32 / Modified mult
+
+        u32 remainder = t % sub1;
+        u32 quotient = static_cast<u32>(t / sub1);
+
+        // Process 4 values of k at once, only seeds that pass the first IV check fall back to scalar code
+        u32 remainderLanes[4];
+        u32 quotientLanes[4];
+        for (int i = 0; i < 4; i++)
         {
-            if ((t % sub1) < 0x8000000)
+            remainderLanes[i] = remainder;
+            quotientLanes[i] = quotient;
+
+            remainder += step;
+            quotient += stepQuotient;
+            if (remainder >= sub1)
             {
-                u32 fullFirst = first | static_cast<u32>(t / sub1);
+                remainder -= sub1;
+                quotient++;
+            }
+        }
+
+        vuint32x4 remainders = v32x4_load(remainderLanes);
+        vuint32x4 quotients = v32x4_load(quotientLanes);
+        vuint32x4 limit = v32x4_set(0x8000000);
+        vuint32x4 modulo = v32x4_set(sub1 - 1);
+        vuint32x4 negModulo = v32x4_set(0 - sub1);
+        vuint32x4 remainderStep = v32x4_set(0x10B7A3BB); // 4 * 2^32 % Modified mult
+        vuint32x4 quotientStep = v32x4_set(25); // 4 * 2^32 / Modified mult
+        vuint32x4 one = v32x4_set(1);
+        vuint32x4 firstCall = v32x4_set(first);
+        vuint32x4 mult = v32x4_set(0x343FD);
+        vuint32x4 add = v32x4_set(0x269EC3);
+        vuint32x4 atkCall = v32x4_set(atk);
+
+        u32 k = 0;
+        for (; k + 3 <= kmax; k += 4)
+        {
+            vuint32x4 valid = v32x4_cmpgt(limit, remainders);
+
+            vuint32x4 seeds = v32x4_or(firstCall, quotients);
+            vuint32x4 atks = v32x4_shr<27>(v32x4_add(v32x4_mul(seeds, mult), add));
+            int mask = v32x4_movemask(v32x4_and(valid, v32x4_cmpeq(atks, atkCall)));
+
+            if (mask)
+            {
+                u32 lanes[4];
+                v32x4_store(lanes, seeds);
+                for (int i = 0; i < 4; i++)
+                {
+                    if (mask & (1 << i))
+                    {
+                        XDRNG rng(lanes[i]);
+                        rng.next();
+                        if ((rng.next() >> 27) == def && (rng.next() >> 27) == spe && (rng.next() >> 27) == spa)
+                        {
+                            origin.emplace_back(lanes[i]);
+                        }
+                    }
+                }
+            }
+
+            remainders = v32x4_add(remainders, remainderStep);
+            vuint32x4 wrap = v32x4_cmpgt(remainders, modulo);
+            remainders = v32x4_add(remainders, v32x4_and(wrap, negModulo));
+            quotients = v32x4_add(quotients, v32x4_add(quotientStep, v32x4_and(wrap, one)));
+        }
+
+        v32x4_store(remainderLanes, remainders);
+        v32x4_store(quotientLanes, quotients);
+        remainder = remainderLanes[0];
+        quotient = quotientLanes[0];
+        for (; k <= kmax; k++)
+        {
+            if (remainder < 0x8000000)
+            {
+                u32 fullFirst = first | quotient;
                 // Check if the next 4 IVs lineup
                 // The euclidean divisor assures the first and last call match up
                 // so there is no need to check if the last call lines up
@@ -127,6 +233,14 @@ namespace RNGEuclidean
                     }
                 }
             }
+
+            remainder += step;
+            quotient += stepQuotient;
+            if (remainder >= sub1)
+            {
+                remainder -= sub1;
+                quotient++;
+            }
         }
 
         return origin;
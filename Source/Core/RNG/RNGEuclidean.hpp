@@ -21,12 +21,16 @@
 #define RNGEUCLIDEAN_HPP
 
 #include <Core/Util/Global.hpp>
+#include <array>
 #include <vector>
 
 namespace RNGEuclidean
 {
     std::vector<std::pair<u32, u32>> recoverLower16BitsIV(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe);
+    u8 recoverLower16BitsIV(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, std::pair<u32, u32> *seeds);
+    size_t recoverLower16BitsIV(const std::array<u8, 6> *ivs, size_t count, std::pair<u32, u32> *seeds, u8 *counts);
     std::vector<std::pair<u32, u32>> recoverLower16BitsPID(u32 pid);
+    u8 recoverLower16BitsPID(u32 pid, std::pair<u32, u32> *seeds);
     std::vector<u32> recoverLower27BitsChannel(u32 hp, u32 atk, u32 def, u32 spa, u32 spd, u32 spe);
 }
 
@@ -81,6 +81,36 @@ inline vuint32x4 v32x4_set(u32 x0, u32 x1, u32 x2, u32 x3)
 #endif
 }
 
+inline vuint32x4 v32x4_add(vuint32x4 x, vuint32x4 y)
+{
+#if defined(__i386__) || defined(_M_IX86) || defined(__x86_64__) || defined(_M_AMD64)
+    return _mm_add_epi32(x, y);
+#elif defined(__arm__) || defined(_M_ARM) || defined(__aarch64__)
+    return vaddq_u32(x, y);
+#else
+    for (int i = 0; i < 4; i++)
+    {
+        x[i] += y[i];
+    }
+    return x;
+#endif
+}
+
+inline vuint32x4 v32x4_mul(vuint32x4 x, vuint32x4 y)
+{
+#if defined(__i386__) || defined(_M_IX86) || defined(__x86_64__) || defined(_M_AMD64)
+    return _mm_mullo_epi32(x, y);
+#elif defined(__arm__) || defined(_M_ARM) || defined(__aarch64__)
+    return vmulq_u32(x, y);
+#else
+    for (int i = 0; i < 4; i++)
+    {
+        x[i] *= y[i];
+    }
+    return x;
+#endif
+}
+
 template <int shift>
 inline vuint32x4 v32x4_shr(vuint32x4 value)
 {
@@ -173,6 +203,35 @@ inline vuint32x4 v32x4_cmpeq(vuint32x4 x, vuint32x4 y)
 #endif
 }
 
+// Only valid for values that fit in 31 bits
+inline vuint32x4 v32x4_cmpgt(vuint32x4 x, vuint32x4 y)
+{
+#if defined(__i386__) || defined(_M_IX86) || defined(__x86_64__) || defined(_M_AMD64)
+    return _mm_cmpgt_epi32(x, y);
+#elif defined(__arm__) || defined(_M_ARM) || defined(__aarch64__)
+    return vcgtq_u32(x, y);
+#else
+    for (int i = 0; i < 4; i++)
+    {
+        x[i] = (x[i] > y[i]) ? 0xffffffff : 0;
+    }
+    return x;
+#endif
+}
+
+// Collects the top bit of each lane into the lower 4 bits of the result
+inline int v32x4_movemask(vuint32x4 x)
+{
+#if defined(__i386__) || defined(_M_IX86) || defined(__x86_64__) || defined(_M_AMD64)
+    return _mm_movemask_ps(_mm_castsi128_ps(x));
+#elif defined(__arm__) || defined(_M_ARM) || defined(__aarch64__)
+    uint32x4_t bits = vshrq_n_u32(x, 31);
+    return vgetq_lane_u32(bits, 0) | (vgetq_lane_u32(bits, 1) << 1) | (vgetq_lane_u32(bits, 2) << 2) | (vgetq_lane_u32(bits, 3) << 3);
+#else
+    return (x[0] >> 31) | ((x[1] >> 31) << 1) | ((x[2] >> 31) << 2) | ((x[3] >> 31) << 3);
+#endif
+}
+
 template <int shift>
 inline vuint32x4 v128_shr(vuint32x4 x)
 {
@@ -21,6 +21,8 @@
 #define XORSHIFT_HPP
 
 #include <Core/Util/Global.hpp>
+#include <algorithm>
+#include <vector>
 
 class Xorshift
 {
@@ -57,16 +59,124 @@ public:
         return next() % max;
     }
 
+    // Advancing n times is the same as evaluating x^n mod the characteristic polynomial of the transition on the state
+    // The lower 7 bits are cheaper to step through than a 128 step jump
     void advance(u32 advances)
     {
-        for (u32 advance = 0; advance < advances; advance++)
+        for (u32 advance = 0; advance < (advances & 0x7f); advance++)
         {
             next();
         }
+
+        for (u8 i = 7; i < 32; i++)
+        {
+            if (advances & (1U << i))
+            {
+                jump(jumpTable[i - 7]);
+            }
+        }
+    }
+
+    // Baby step giant step over 2^16 advances at a time
+    // End has to be within 0xfffffffe advances of start, otherwise 0xffffffff is returned
+    static u32 distance(const Xorshift &start, const Xorshift &end)
+    {
+        constexpr u32 size = 0x10000;
+
+        std::vector<std::pair<u64, u32>> steps;
+        steps.reserve(size);
+
+        Xorshift rng(end);
+        for (u32 i = 0; i < size; i++, rng.next())
+        {
+            steps.emplace_back(rng.getKey(), i);
+        }
+        std::sort(steps.begin(), steps.end());
+
+        // Start advanced j * 2^16 times matching end advanced i times means the distance is j * 2^16 - i
+        Xorshift giant(start);
+        for (u64 j = 0; j <= size; j++, giant.jump(jumpTable[16 - 7]))
+        {
+            u64 key = giant.getKey();
+            auto it = std::lower_bound(steps.begin(), steps.end(), std::make_pair(key, 0U));
+            for (; it != steps.end() && it->first == key; ++it)
+            {
+                u64 advances = j * size - it->second;
+                if (j * size < it->second || advances > 0xfffffffe)
+                {
+                    continue;
+                }
+
+                Xorshift check(start);
+                check.advance(advances);
+                if (check.getKey() == end.getKey() && check.state[2] == end.state[2] && check.state[3] == end.state[3])
+                {
+                    return advances;
+                }
+            }
+        }
+
+        return 0xffffffff;
     }
 
 public:
     u32 state[4];
+
+private:
+    // x^(2^i) mod the characteristic polynomial for i = 7 to 31, lower 64 coefficients first
+    static constexpr u64 jumpTable[25][2] = {
+        { 0xF985D65FFD3C8001, 0x000000010046D8B3 },
+        { 0xA42CA9AEB1E10DA6, 0x956C89FBFA6B67E9 },
+        { 0x1A0988E988F8A56E, 0xFF7AA97C47EC17C7 },
+        { 0xFB6668FF443B16F0, 0x9DFF33679BD01948 },
+        { 0x46A4759B1DC83CE2, 0xBD36A1D3E3B212DA },
+        { 0x9640BC4CA0CBAA6C, 0x6D2F354B8B0E3C0B },
+        { 0x947096C72B4D52FB, 0xECF6383DCA4F108F },
+        { 0x0DAF32F04DDCA12E, 0xE1054E817177890A },
+        { 0xB9FA05AAB78641A5, 0x02AE1912115107C6 },
+        { 0x382FA5AA95F950E3, 0x59981D3DF81649BE },
+        { 0xDBA31D29FC044FDB, 0x6644B35F0F8CEE00 },
+        { 0x3CA16B953C338C19, 0xECFF213C169FD455 },
+        { 0x3FFDCB096A60ECBE, 0xA9DFD9FB0A094939 },
+        { 0xFD6AEF50F8C0B5FA, 0x079D7462B16C479F },
+        { 0x9148889B8269B55D, 0x03896736D707B6B6 },
+        { 0x4C6AC659B91EF36A, 0xDEA22E8899DBBEAA },
+        { 0x67CCF586CDDB0649, 0xC1150DDD5AE7D320 },
+        { 0x33C8177D6B2CC0F0, 0x5F0BE91AC7E9C381 },
+        { 0x4A5F78FC104E47B9, 0x0CD15D2BA212E573 },
+        { 0xD69063E6E8A0B936, 0xAB586674147DEC3E },
+        { 0x7071114AF22D34F5, 0x4BFD9D67ED372866 },
+        { 0x686287302B5CD38C, 0xDAF387CAB4EF5C18 },
+        { 0xBB7D371F547CCA1E, 0xFFAF82745790AF3E },
+        { 0xEB96ACD6C88829F9, 0x7B932849FE573AFA },
+        { 0xB4FD2C6573BF7047, 0x8CEDF8DFE2D6E821 },
+    };
+
+    u64 getKey() const
+    {
+        return (static_cast<u64>(state[0]) << 32) | state[1];
+    }
+
+    void jump(const u64 *polynomial)
+    {
+        u32 jump[4] = { 0, 0, 0, 0 };
+        for (u8 i = 0; i < 128; i++)
+        {
+            if ((polynomial[i >> 6] >> (i & 63)) & 1)
+            {
+                for (u8 j = 0; j < 4; j++)
+                {
+                    jump[j] ^= state[j];
+                }
+            }
+            next();
+        }
+
+        for (u8 j = 0; j < 4; j++)
+        {
+            state[j] = jump[j];
+        }
+    }
 };
 
 #endif // XORSHIFT_HPP
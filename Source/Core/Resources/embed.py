@@ -3,104 +3,84 @@
 import glob
 import json
 import os
-import re
+
+
+def compress(data):
+    # LZ4 block format, greedy matching with a 4 byte hash table
+    # The last match has to start 12 bytes before the end and the last 5 bytes are always literals
+    output = bytearray()
+    table = {}
+    anchor = 0
+    i = 0
+    limit = len(data) - 12
+
+    def write_length(length):
+        while length >= 255:
+            output.append(255)
+            length -= 255
+        output.append(length)
+
+    while i < limit:
+        key = data[i:i + 4]
+        candidate = table.get(key)
+        table[key] = i
+        if candidate is None or i - candidate > 0xffff:
+            i += 1
+            continue
+
+        length = 4
+        while i + length < len(data) - 5 and data[candidate + length] == data[i + length]:
+            length += 1
+
+        literals = i - anchor
+        match = length - 4
+        output.append((min(literals, 15) << 4) | min(match, 15))
+        if literals >= 15:
+            write_length(literals - 15)
+        output += data[anchor:i]
+        output += (i - candidate).to_bytes(2, "little")
+        if match >= 15:
+            write_length(match - 15)
+
+        i += length
+        anchor = i
+
+    literals = len(data) - anchor
+    output.append(min(literals, 15) << 4)
+    if literals >= 15:
+        write_length(literals - 15)
+    output += data[anchor:]
+
+    return output
 
 
 def embed_encounters():
-    arrays = []
+    resources = {}
 
     files = glob.glob("Encounters/**/*.bin", recursive=True)
     for file in files:
         with open(file, "rb") as f:
-            data = f.read()
-
-        name = os.path.basename(f.name).replace(".bin", "")
-
-        string = f"constexpr std::array<u8, {len(data)}> {name} ="
-        string += " { "
-
-        for i in range(len(data)):
-            string += str(data[i])
-            if i != len(data) - 1:
-                string += ", "
-
-        string += " };"
-        arrays.append(string)
+            resources[os.path.basename(f.name).replace(".bin", "")] = f.read()
 
     # Handle raids seperately
+    # Each den is stored as a fixed size record so DenLoader can read it in place
+    # 8 byte table hash followed by 12 sword and 12 shield raids of 8 bytes each
     with open("Encounters/Gen8/nests.json") as f:
-        data = json.load(f)
-        tables = data["Tables"]
-
-        # Since some raids have altform of non 0
-        # We need to dynamically adjust the index we lookup in the personal table
-        with open("Personal.hpp", "r") as f_personal:
-            data = f_personal.readlines()
-            for line in data:
-                if "personal8" in line:
-                    personal = re.findall(r"PersonalInfo\(.+?\)", line)
-                    for i in range(len(personal)):
-                        personal[i] = re.search(r"\((.+?)\)", personal[i]).group(1).split(", ")
+        tables = json.load(f)["Tables"]
 
-        name = os.path.basename(f.name).replace(".json", "")
+    tables.sort(key=lambda den: int(f"0x{den['TableID']}", 16))
 
-        string = f"constexpr std::array<Den, {len(tables)}> {name} ="
-        string += " { "
-
-        tables.sort(key=lambda den: int(f"0x{den['TableID']}", 16))
-        for i, table in enumerate(tables):
-            string += f"Den(0x{table['TableID']}, "
-            
-            string += "std::array<Raid, 12> {"
-            sword = table["SwordEntries"]
-            for j, raid in enumerate(sword):
-                ability = raid["Ability"]
-                altform = raid["AltForm"]
-                iv_count = raid["FlawlessIVs"]
-                gender = raid["Gender"]
-                gigantamax = int(raid["IsGigantamax"])
-                species = raid["Species"]
-                stars = raid["Stars"]
-                star_string = "std::array<bool, 5> {" + f"{int(stars[0])}, {int(stars[1])}, {int(stars[2])}, {int(stars[3])}, {int(stars[4])}" + "}"
-
-                personal_index = species
-                if altform != 0:
-                    altform_index = int(personal[species][11])
-                    personal_index = altform_index + altform - 1 
-
-                string += f"Raid({ability}, {altform}, {iv_count}, {gender}, {gigantamax}, {species}, personal8[{personal_index}], {star_string})"
-                if j != len(sword) - 1:
-                    string += ", "
-            string += "}, "
-
-            string += "std::array<Raid, 12> {"
-            shield = table["ShieldEntries"]
-            for j, raid in enumerate(shield):
-                ability = raid["Ability"]
-                altform = raid["AltForm"]
-                iv_count = raid["FlawlessIVs"]
-                gender = raid["Gender"]
-                gigantamax = int(raid["IsGigantamax"])
-                species = raid["Species"]
-                stars = raid["Stars"]
-                star_string = "std::array<bool, 5> {" + f"{int(stars[0])}, {int(stars[1])}, {int(stars[2])}, {int(stars[3])}, {int(stars[4])}" + "}"
-
-                personal_index = species
-                if altform != 0:
-                    altform_index = int(personal[species][11])
-                    personal_index = altform_index + altform - 1 
-
-                string += f"Raid({ability}, {altform}, {iv_count}, {gender}, {gigantamax}, {species}, personal8[{personal_index}], {star_string})"
-                if j != len(sword) - 1:
-                    string += ", "
-            string += "})"
-            if i != len(tables) - 1:
-                string += ", "
-        string += "};"
+    data = bytearray()
+    for table in tables:
+        data += int(f"0x{table['TableID']}", 16).to_bytes(8, "little")
+        for raid in table["SwordEntries"] + table["ShieldEntries"]:
+            stars = sum(int(star) << i for i, star in enumerate(raid["Stars"]))
+            data += raid["Species"].to_bytes(2, "little")
+            data += bytes((raid["AltForm"], raid["Ability"], raid["FlawlessIVs"], raid["Gender"], int(raid["IsGigantamax"]), stars))
 
-        arrays.append(string)
+    resources["nests"] = bytes(data)
 
-    write_data(arrays, "Encounters.hpp", ("Core/Gen8/Den.hpp", "Core/Util/Global.hpp", "Core/Resources/Personal.hpp", "array"))
+    return resources
 
 
 def embed_personal():
@@ -171,39 +151,22 @@ def embed_personal():
 
 
 def embed_strings(paths):
-    arrays = []
-    for path in paths:
-        mapping = {}
+    resources = {}
 
+    for path in paths:
         files = glob.glob(f"i18n/{path}/*.txt", recursive=True)
         for file in files:
             with open(file, "r", encoding="utf-8") as f:
                 data = f.read().split("\n")
 
-            name = os.path.basename(f.name).replace(".txt", "")
-
-            string_data = []
+            string_data = bytearray()
             for line in data:
-                line = line.replace('\r', '').replace('\n', '')
-
-                for x in [int(y) for y in bytearray(line, encoding="utf-8")]:
-                    string_data.append(x)
+                string_data += line.replace("\r", "").encode("utf-8")
                 string_data.append(0)
 
-            string = f"constexpr std::array<u8, {len(string_data)}> {name} ="
-            string += " { "
-
-            for i in range(len(string_data)):
-                string += str(string_data[i])
-                if i != len(string_data) - 1:
-                    string += ", "
-
-            string += " };"
-            mapping[name] = string
-
-        arrays.append(mapping)
+            resources[os.path.basename(f.name).replace(".txt", "")] = bytes(string_data)
 
-    write_strings(arrays)
+    return resources
 
 
 def write_data(arrays, file, includes):
@@ -217,15 +180,25 @@ def write_data(arrays, file, includes):
         f.write(f"{array}\n\n")
 
 
-def write_strings(maps):
-    f = open("i18n.hpp", "w", encoding="utf-8")
+def write_resources(resources):
+    # Every resource is compressed on its own so only the ones that get used are ever decompressed
+    # The directory is sorted by name and stores the offset, compressed size and size of each resource
+    names = sorted(resources)
 
-    f.write("#include <Core/Util/Global.hpp>\n")
-    f.write("#include <array>\n\n")
+    data = bytearray()
+    entries = []
+    for name in names:
+        block = compress(resources[name])
+        entries.append(f"std::array<u32, 3> {{ {len(data)}, {len(block)}, {len(resources[name])} }}")
+        data += block
 
-    for map in maps:
-        for string in map.values():
-            f.write(f"{string}\n\n")
+    arrays = []
+    arrays.append(f"constexpr std::array<u8, {len(data)}> resources = {{ {', '.join(str(byte) for byte in data)} }};")
+    quoted = ", ".join(f'"{name}"' for name in names)
+    arrays.append(f"constexpr std::array<const char *, {len(names)}> resourceNames = {{ {quoted} }};")
+    arrays.append(f"constexpr std::array<std::array<u32, 3>, {len(names)}> resourceEntries = {{ {', '.join(entries)} }};")
+
+    write_data(arrays, "Resources.hpp", ("Core/Util/Global.hpp", "array"))
 
 
 def main():
@@ -233,8 +206,10 @@ def main():
     os.chdir(pathlib.Path(__file__).parent.absolute())
 
     embed_personal()
-    embed_encounters()
-    embed_strings(["de", "en", "es", "fr", "it", "ja", "ko", "zh"])
+
+    resources = embed_encounters()
+    resources.update(embed_strings(["de", "en", "es", "fr", "it", "ja", "ko", "zh"]))
+    write_resources(resources)
 
 
 if __name__ == "__main__":
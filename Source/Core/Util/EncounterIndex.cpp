@@ -0,0 +1,164 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "EncounterIndex.hpp"
+#include <Core/Enum/Encounter.hpp>
+#include <Core/Enum/Game.hpp>
+#include <Core/Gen3/EncounterArea3.hpp>
+#include <Core/Gen3/Encounters3.hpp>
+#include <Core/Gen3/Profile3.hpp>
+#include <Core/Gen4/EncounterArea4.hpp>
+#include <Core/Gen4/Encounters4.hpp>
+#include <Core/Gen4/Profile4.hpp>
+#include <map>
+#include <mutex>
+
+namespace
+{
+    // Locations of every species indexed by species, built the first time a game is looked up
+    std::map<Game, std::vector<std::vector<SpeciesLocation>>> indexes;
+    std::mutex mutex;
+
+    void addArea(std::vector<std::vector<SpeciesLocation>> &index, const EncounterArea &area)
+    {
+        std::vector<Slot> pokemon = area.getPokemon();
+        for (size_t i = 0; i < pokemon.size(); i++)
+        {
+            const Slot &slot = pokemon[i];
+            if (slot.getSpecie() >= index.size())
+            {
+                index.resize(slot.getSpecie() + 1);
+            }
+
+            auto &locations = index[slot.getSpecie()];
+            auto it = std::find_if(locations.begin(), locations.end(), [&area](const SpeciesLocation &location) {
+                return location.getLocation() == area.getLocation() && location.getEncounter() == area.getEncounter();
+            });
+
+            if (it == locations.end())
+            {
+                locations.emplace_back(area.getLocation(), area.getEncounter(), slot.getMinLevel(), slot.getMaxLevel(), 1 << i);
+            }
+            else
+            {
+                it->merge(slot.getMinLevel(), slot.getMaxLevel(), 1 << i);
+            }
+        }
+    }
+
+    void addGen3(std::vector<std::vector<SpeciesLocation>> &index, Game game)
+    {
+        Profile3 profile("", game, 0, 0);
+
+        for (auto type : { Encounter::Grass, Encounter::SafariZone, Encounter::RockSmash, Encounter::Surfing, Encounter::OldRod,
+                           Encounter::GoodRod, Encounter::SuperRod })
+        {
+            for (const auto &area : Encounters3::getEncounters(type, profile))
+            {
+                addArea(index, area);
+            }
+        }
+    }
+
+    void addGen4(std::vector<std::vector<SpeciesLocation>> &index, Game game)
+    {
+        // Every combination of the profile options that can change the slots
+        std::vector<Profile4> profiles;
+        if (game & Game::HGSS)
+        {
+            for (int radio : { 0, 1, 2 })
+            {
+                for (bool swarm : { false, true })
+                {
+                    profiles.emplace_back("", game, 0, 0, Game::Blank, radio, false, swarm);
+                }
+            }
+        }
+        else
+        {
+            for (Game dual : { Game::Emerald, Game::Ruby, Game::Sapphire, Game::FireRed, Game::LeafGreen })
+            {
+                for (bool swarm : { false, true })
+                {
+                    for (bool radar : { false, true })
+                    {
+                        profiles.emplace_back("", game, 0, 0, dual, 0, radar, swarm);
+                    }
+                }
+            }
+        }
+
+        for (const auto &profile : profiles)
+        {
+            for (int time : { 0, 1, 2 })
+            {
+                for (auto type : { Encounter::Grass, Encounter::RockSmash, Encounter::Surfing, Encounter::OldRod, Encounter::GoodRod,
+                                   Encounter::SuperRod })
+                {
+                    for (const auto &area : Encounters4::getEncounters(type, time, profile))
+                    {
+                        addArea(index, area);
+                    }
+                }
+            }
+        }
+    }
+
+    const std::vector<std::vector<SpeciesLocation>> &getIndex(Game game)
+    {
+        auto it = indexes.find(game);
+        if (it == indexes.end())
+        {
+            std::vector<std::vector<SpeciesLocation>> index;
+            if ((game & Game::FRLG) || (game & Game::RSE))
+            {
+                addGen3(index, game);
+            }
+            else if ((game & Game::DPPt) || (game & Game::HGSS))
+            {
+                addGen4(index, game);
+            }
+
+            for (auto &locations : index)
+            {
+                std::sort(locations.begin(), locations.end(), [](const SpeciesLocation &left, const SpeciesLocation &right) {
+                    return left.getLocation() < right.getLocation()
+                        || (left.getLocation() == right.getLocation() && left.getEncounter() < right.getEncounter());
+                });
+            }
+
+            it = indexes.emplace(game, std::move(index)).first;
+        }
+
+        return it->second;
+    }
+}
+
+namespace EncounterIndex
+{
+    const std::vector<SpeciesLocation> &getLocations(Game game, u16 species)
+    {
+        static const std::vector<SpeciesLocation> empty;
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        const auto &index = getIndex(game);
+        return species < index.size() ? index[species] : empty;
+    }
+}
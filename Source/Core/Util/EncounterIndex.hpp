@@ -0,0 +1,84 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef ENCOUNTERINDEX_HPP
+#define ENCOUNTERINDEX_HPP
+
+#include <Core/Util/Global.hpp>
+#include <algorithm>
+#include <vector>
+
+enum Encounter : u8;
+enum Game : u32;
+
+class SpeciesLocation
+{
+public:
+    SpeciesLocation(u8 location, Encounter encounter, u8 minLevel, u8 maxLevel, u16 slots) :
+        location(location), encounter(encounter), minLevel(minLevel), maxLevel(maxLevel), slots(slots)
+    {
+    }
+
+    u8 getLocation() const
+    {
+        return location;
+    }
+
+    Encounter getEncounter() const
+    {
+        return encounter;
+    }
+
+    u8 getMinLevel() const
+    {
+        return minLevel;
+    }
+
+    u8 getMaxLevel() const
+    {
+        return maxLevel;
+    }
+
+    // Bit i is set if the species appears in slot i
+    u16 getSlots() const
+    {
+        return slots;
+    }
+
+    void merge(u8 minLevel, u8 maxLevel, u16 slots)
+    {
+        this->minLevel = std::min(this->minLevel, minLevel);
+        this->maxLevel = std::max(this->maxLevel, maxLevel);
+        this->slots |= slots;
+    }
+
+private:
+    u8 location;
+    Encounter encounter;
+    u8 minLevel;
+    u8 maxLevel;
+    u16 slots;
+};
+
+namespace EncounterIndex
+{
+    const std::vector<SpeciesLocation> &getLocations(Game game, u16 species);
+}
+
+#endif // ENCOUNTERINDEX_HPP
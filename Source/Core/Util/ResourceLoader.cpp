@@ -0,0 +1,118 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "ResourceLoader.hpp"
+#include <Core/Resources/Resources.hpp>
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <mutex>
+
+namespace
+{
+    std::map<size_t, std::vector<u8>> cache;
+    std::mutex mutex;
+
+    // Decodes a LZ4 block as written by embed.py
+    std::vector<u8> decompress(const u8 *data, size_t compressedSize, size_t size)
+    {
+        std::vector<u8> output(size);
+
+        const u8 *end = data + compressedSize;
+        size_t index = 0;
+        while (data < end)
+        {
+            u8 token = *data++;
+
+            size_t literals = token >> 4;
+            if (literals == 15)
+            {
+                u8 length;
+                do
+                {
+                    length = *data++;
+                    literals += length;
+                } while (length == 255);
+            }
+
+            if (literals)
+            {
+                std::memcpy(output.data() + index, data, literals);
+                data += literals;
+                index += literals;
+            }
+
+            // Last sequence only has literals
+            if (data >= end)
+            {
+                break;
+            }
+
+            size_t offset = data[0] | (data[1] << 8);
+            data += 2;
+
+            size_t match = (token & 15) + 4;
+            if ((token & 15) == 15)
+            {
+                u8 length;
+                do
+                {
+                    length = *data++;
+                    match += length;
+                } while (length == 255);
+            }
+
+            // Matches can overlap the bytes they produce so copy one at a time
+            for (size_t i = 0; i < match; i++, index++)
+            {
+                output[index] = output[index - offset];
+            }
+        }
+
+        return output;
+    }
+}
+
+namespace ResourceLoader
+{
+    const std::vector<u8> &getResource(const std::string &name)
+    {
+        static const std::vector<u8> empty;
+
+        auto it = std::lower_bound(resourceNames.begin(), resourceNames.end(), name,
+                                   [](const char *left, const std::string &right) { return right.compare(left) > 0; });
+        if (it == resourceNames.end() || name != *it)
+        {
+            return empty;
+        }
+
+        size_t index = std::distance(resourceNames.begin(), it);
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto entry = cache.find(index);
+        if (entry == cache.end())
+        {
+            const auto &info = resourceEntries[index];
+            entry = cache.emplace(index, decompress(resources.data() + info[0], info[1], info[2])).first;
+        }
+
+        return entry->second;
+    }
+}
@@ -19,464 +19,116 @@
 
 #include "Translator.hpp"
 #include <Core/Enum/Game.hpp>
-#include <Core/Resources/i18n.hpp>
+#include <Core/Util/ResourceLoader.hpp>
 #include <algorithm>
-#include <map>
-#include <sstream>
+#include <array>
+#include <mutex>
 
 namespace
 {
+    enum class Table : u8
+    {
+        Characteristics,
+        Natures,
+        Abilities,
+        HiddenPowers,
+        Species,
+        FRLG,
+        RSE,
+        DPPt,
+        HGSS,
+        SwSh,
+        Count
+    };
+
+    constexpr u8 tableCount = static_cast<u8>(Table::Count);
+    constexpr const char *tableNames[tableCount]
+        = { "characteristic", "natures", "abilities", "powers", "species", "frlg", "rse", "dppt", "hgss", "swsh" };
+
     std::string language;
-    std::vector<std::string> characteristics;
-    std::vector<std::string> natures;
-    std::vector<std::string> abilities;
-    std::vector<std::string> hiddenPowers;
-    std::vector<std::string> species;
+    std::array<std::vector<std::string>, tableCount> tables;
+    std::array<bool, tableCount> loaded;
+    std::mutex mutex;
+
+    const std::string empty;
     const std::vector<std::string> genders = { "♂", "♀", "-" };
     const std::vector<std::string> buttons = { "R", "L", "X", "Y", "A", "B", "Select", "Start", "Right", "Left", "Up", "Down" };
 
     std::vector<std::string> readFile(const std::string &name)
     {
-        const u8 *data;
-        size_t size = 0;
+        const std::vector<u8> &resource = ResourceLoader::getResource(name + "_" + language);
+        const u8 *data = resource.data();
+        size_t size = resource.size();
 
-        if (language == "de")
-        {
-            if (name == "characteristic")
-            {
-                data = characteristic_de.data();
-                size = characteristic_de.size();
-            }
-            else if (name == "natures")
-            {
-                data = natures_de.data();
-                size = natures_de.size();
-            }
-            else if (name == "abilities")
-            {
-                data = abilities_de.data();
-                size = abilities_de.size();
-            }
-            else if (name == "powers")
-            {
-                data = powers_de.data();
-                size = powers_de.size();
-            }
-            else if (name == "species")
-            {
-                data = species_de.data();
-                size = species_de.size();
-            }
-            else if (name == "frlg")
-            {
-                data = frlg_de.data();
-                size = frlg_de.size();
-            }
-            else if (name == "rse")
-            {
-                data = rse_de.data();
-                size = rse_de.size();
-            }
-            else if (name == "dppt")
-            {
-                data = dppt_de.data();
-                size = dppt_de.size();
-            }
-            else if (name == "hgss")
-            {
-                data = hgss_de.data();
-                size = hgss_de.size();
-            }
-            else if (name == "swsh")
-            {
-                data = swsh_de.data();
-                size = swsh_de.size();
-            }
-        }
-        else if (language == "en")
+        std::vector<std::string> strings;
+        size_t start = 0;
+        for (size_t i = 0; i < size; i++)
         {
-            if (name == "characteristic")
-            {
-                data = characteristic_en.data();
-                size = characteristic_en.size();
-            }
-            else if (name == "natures")
-            {
-                data = natures_en.data();
-                size = natures_en.size();
-            }
-            else if (name == "abilities")
-            {
-                data = abilities_en.data();
-                size = abilities_en.size();
-            }
-            else if (name == "powers")
-            {
-                data = powers_en.data();
-                size = powers_en.size();
-            }
-            else if (name == "species")
-            {
-                data = species_en.data();
-                size = species_en.size();
-            }
-            else if (name == "frlg")
-            {
-                data = frlg_en.data();
-                size = frlg_en.size();
-            }
-            else if (name == "rse")
-            {
-                data = rse_en.data();
-                size = rse_en.size();
-            }
-            else if (name == "dppt")
-            {
-                data = dppt_en.data();
-                size = dppt_en.size();
-            }
-            else if (name == "hgss")
-            {
-                data = hgss_en.data();
-                size = hgss_en.size();
-            }
-            else if (name == "swsh")
+            if (data[i] == 0)
             {
-                data = swsh_en.data();
-                size = swsh_en.size();
+                strings.emplace_back((const char *)&data[start], i - start);
+                start = i + 1;
             }
         }
-        else if (language == "es")
+
+        return strings;
+    }
+
+    // Tables are read the first time they are used and kept for the rest of the session
+    // Location files store "number,name" lines and are laid out by location number so lookups are a plain index
+    const std::vector<std::string> &getTable(Table table)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        u8 index = static_cast<u8>(table);
+        if (!loaded[index])
         {
-            if (name == "characteristic")
-            {
-                data = characteristic_es.data();
-                size = characteristic_es.size();
-            }
-            else if (name == "natures")
-            {
-                data = natures_es.data();
-                size = natures_es.size();
-            }
-            else if (name == "abilities")
-            {
-                data = abilities_es.data();
-                size = abilities_es.size();
-            }
-            else if (name == "powers")
-            {
-                data = powers_es.data();
-                size = powers_es.size();
-            }
-            else if (name == "species")
-            {
-                data = species_es.data();
-                size = species_es.size();
-            }
-            else if (name == "frlg")
-            {
-                data = frlg_es.data();
-                size = frlg_es.size();
-            }
-            else if (name == "rse")
-            {
-                data = rse_es.data();
-                size = rse_es.size();
-            }
-            else if (name == "dppt")
-            {
-                data = dppt_es.data();
-                size = dppt_es.size();
-            }
-            else if (name == "hgss")
-            {
-                data = hgss_es.data();
-                size = hgss_es.size();
-            }
-            else if (name == "swsh")
+            std::vector<std::string> strings = readFile(tableNames[index]);
+            if (table >= Table::FRLG)
             {
-                data = swsh_es.data();
-                size = swsh_es.size();
+                std::vector<std::string> locations;
+                for (const std::string &string : strings)
+                {
+                    size_t comma = string.find(',');
+                    size_t num = std::stoul(string.substr(0, comma));
+                    if (num >= locations.size())
+                    {
+                        locations.resize(num + 1);
+                    }
+                    locations[num] = string.substr(comma + 1);
+                }
+                strings = std::move(locations);
             }
+
+            tables[index] = std::move(strings);
+            loaded[index] = true;
         }
-        else if (language == "fr")
+
+        return tables[index];
+    }
+
+    Table getLocationTable(Game game)
+    {
+        if (game & Game::FRLG)
         {
-            if (name == "characteristic")
-            {
-                data = characteristic_fr.data();
-                size = characteristic_fr.size();
-            }
-            else if (name == "natures")
-            {
-                data = natures_fr.data();
-                size = natures_fr.size();
-            }
-            else if (name == "abilities")
-            {
-                data = abilities_fr.data();
-                size = abilities_fr.size();
-            }
-            else if (name == "powers")
-            {
-                data = powers_fr.data();
-                size = powers_fr.size();
-            }
-            else if (name == "species")
-            {
-                data = species_fr.data();
-                size = species_fr.size();
-            }
-            else if (name == "frlg")
-            {
-                data = frlg_fr.data();
-                size = frlg_fr.size();
-            }
-            else if (name == "rse")
-            {
-                data = rse_fr.data();
-                size = rse_fr.size();
-            }
-            else if (name == "dppt")
-            {
-                data = dppt_fr.data();
-                size = dppt_fr.size();
-            }
-            else if (name == "hgss")
-            {
-                data = hgss_fr.data();
-                size = hgss_fr.size();
-            }
-            else if (name == "swsh")
-            {
-                data = swsh_fr.data();
-                size = swsh_fr.size();
-            }
+            return Table::FRLG;
         }
-        else if (language == "it")
-        {
-            if (name == "characteristic")
-            {
-                data = characteristic_it.data();
-                size = characteristic_it.size();
-            }
-            else if (name == "natures")
-            {
-                data = natures_it.data();
-                size = natures_it.size();
-            }
-            else if (name == "abilities")
-            {
-                data = abilities_it.data();
-                size = abilities_it.size();
-            }
-            else if (name == "powers")
-            {
-                data = powers_it.data();
-                size = powers_it.size();
-            }
-            else if (name == "species")
-            {
-                data = species_it.data();
-                size = species_it.size();
-            }
-            else if (name == "frlg")
-            {
-                data = frlg_it.data();
-                size = frlg_it.size();
-            }
-            else if (name == "rse")
-            {
-                data = rse_it.data();
-                size = rse_it.size();
-            }
-            else if (name == "dppt")
-            {
-                data = dppt_it.data();
-                size = dppt_it.size();
-            }
-            else if (name == "hgss")
-            {
-                data = hgss_it.data();
-                size = hgss_it.size();
-            }
-            else if (name == "swsh")
-            {
-                data = swsh_it.data();
-                size = swsh_it.size();
-            }
-        }
-        else if (language == "ja")
+        else if (game & Game::RSE)
         {
-            if (name == "characteristic")
-            {
-                data = characteristic_ja.data();
-                size = characteristic_ja.size();
-            }
-            else if (name == "natures")
-            {
-                data = natures_ja.data();
-                size = natures_ja.size();
-            }
-            else if (name == "abilities")
-            {
-                data = abilities_ja.data();
-                size = abilities_ja.size();
-            }
-            else if (name == "powers")
-            {
-                data = powers_ja.data();
-                size = powers_ja.size();
-            }
-            else if (name == "species")
-            {
-                data = species_ja.data();
-                size = species_ja.size();
-            }
-            else if (name == "frlg")
-            {
-                data = frlg_ja.data();
-                size = frlg_ja.size();
-            }
-            else if (name == "rse")
-            {
-                data = rse_ja.data();
-                size = rse_ja.size();
-            }
-            else if (name == "dppt")
-            {
-                data = dppt_ja.data();
-                size = dppt_ja.size();
-            }
-            else if (name == "hgss")
-            {
-                data = hgss_ja.data();
-                size = hgss_ja.size();
-            }
-            else if (name == "swsh")
-            {
-                data = swsh_ja.data();
-                size = swsh_ja.size();
-            }
+            return Table::RSE;
         }
-        else if (language == "ko")
+        else if (game & Game::DPPt)
         {
-            if (name == "characteristic")
-            {
-                data = characteristic_ko.data();
-                size = characteristic_ko.size();
-            }
-            else if (name == "natures")
-            {
-                data = natures_ko.data();
-                size = natures_ko.size();
-            }
-            else if (name == "abilities")
-            {
-                data = abilities_ko.data();
-                size = abilities_ko.size();
-            }
-            else if (name == "powers")
-            {
-                data = powers_ko.data();
-                size = powers_ko.size();
-            }
-            else if (name == "species")
-            {
-                data = species_ko.data();
-                size = species_ko.size();
-            }
-            else if (name == "frlg")
-            {
-                data = frlg_ko.data();
-                size = frlg_ko.size();
-            }
-            else if (name == "rse")
-            {
-                data = rse_ko.data();
-                size = rse_ko.size();
-            }
-            else if (name == "dppt")
-            {
-                data = dppt_ko.data();
-                size = dppt_ko.size();
-            }
-            else if (name == "hgss")
-            {
-                data = hgss_ko.data();
-                size = hgss_ko.size();
-            }
-            else if (name == "swsh")
-            {
-                data = swsh_ko.data();
-                size = swsh_ko.size();
-            }
+            return Table::DPPt;
         }
-        else if (language == "zh")
+        else if (game & Game::HGSS)
         {
-            if (name == "characteristic")
-            {
-                data = characteristic_zh.data();
-                size = characteristic_zh.size();
-            }
-            else if (name == "natures")
-            {
-                data = natures_zh.data();
-                size = natures_zh.size();
-            }
-            else if (name == "abilities")
-            {
-                data = abilities_zh.data();
-                size = abilities_zh.size();
-            }
-            else if (name == "powers")
-            {
-                data = powers_zh.data();
-                size = powers_zh.size();
-            }
-            else if (name == "species")
-            {
-                data = species_zh.data();
-                size = species_zh.size();
-            }
-            else if (name == "frlg")
-            {
-                data = frlg_zh.data();
-                size = frlg_zh.size();
-            }
-            else if (name == "rse")
-            {
-                data = rse_zh.data();
-                size = rse_zh.size();
-            }
-            else if (name == "dppt")
-            {
-                data = dppt_zh.data();
-                size = dppt_zh.size();
-            }
-            else if (name == "hgss")
-            {
-                data = hgss_zh.data();
-                size = hgss_zh.size();
-            }
-            else if (name == "swsh")
-            {
-                data = swsh_zh.data();
-                size = swsh_zh.size();
-            }
+            return Table::HGSS;
         }
-
-        std::vector<std::string> strings;
-        size_t start = 0;
-        for (size_t i = 0; i < size; i++)
+        else
         {
-            if (data[i] == 0)
-            {
-                strings.emplace_back((const char *)&data[start], i - start);
-                start = i + 1;
-            }
+            return Table::SwSh;
         }
-
-        return strings;
     }
 }
 
@@ -484,117 +136,86 @@ namespace Translator
 {
     void init(const std::string &locale)
     {
-        language = locale;
+        std::lock_guard<std::mutex> lock(mutex);
 
-        characteristics = readFile("characteristic");
-        natures = readFile("natures");
-        abilities = readFile("abilities");
-        hiddenPowers = readFile("powers");
-        species = readFile("species");
+        language = locale;
+        loaded.fill(false);
     }
 
-    std::vector<std::string> getCharacteristic()
+    const std::vector<std::string> &getCharacteristic()
     {
-        return characteristics;
+        return getTable(Table::Characteristics);
     }
 
-    std::vector<std::string> getNatures()
+    const std::vector<std::string> &getNatures()
     {
-        return natures;
+        return getTable(Table::Natures);
     }
 
-    std::string getNature(u8 nature)
+    const std::string &getNature(u8 nature)
     {
-        return natures[nature];
+        return getTable(Table::Natures)[nature];
     }
 
-    std::string getAbility(u16 ability)
+    const std::string &getAbility(u16 ability)
     {
-        return abilities[ability];
+        return getTable(Table::Abilities)[ability];
     }
 
-    std::vector<std::string> getHiddenPowers()
+    const std::vector<std::string> &getHiddenPowers()
     {
-        return hiddenPowers;
+        return getTable(Table::HiddenPowers);
     }
 
-    std::string getHiddenPower(u8 power)
+    const std::string &getHiddenPower(u8 power)
     {
-        return hiddenPowers[power];
+        return getTable(Table::HiddenPowers)[power];
     }
 
-    std::string getSpecies(u16 specie)
+    const std::string &getSpecies(u16 specie)
     {
-        return species[specie - 1];
+        return getTable(Table::Species)[specie - 1];
     }
 
     std::vector<std::string> getSpecies(const std::vector<u16> &nums)
     {
+        const auto &species = getTable(Table::Species);
+
         std::vector<std::string> s;
-        std::transform(nums.begin(), nums.end(), std::back_inserter(s), [](u16 num) { return species[num - 1]; });
+        std::transform(nums.begin(), nums.end(), std::back_inserter(s), [&species](u16 num) { return species[num - 1]; });
         return s;
     }
 
-    std::string getGender(u8 gender)
+    const std::string &getGender(u8 gender)
     {
         return genders[gender];
     }
 
-    std::vector<std::string> getGenders()
+    const std::vector<std::string> &getGenders()
     {
         return genders;
     }
 
-    std::vector<std::string> getLocations(const std::vector<u8> &nums, Game game)
+    const std::string &getLocation(u8 num, Game game)
     {
-        std::vector<std::string> strings;
-        if (game & Game::FRLG)
-        {
-            strings = readFile("frlg");
-        }
-        else if (game & Game::RSE)
-        {
-            strings = readFile("rse");
-        }
-        else if (game & Game::DPPt)
-        {
-            strings = readFile("dppt");
-        }
-        else if (game & Game::HGSS)
-        {
-            strings = readFile("hgss");
-        }
-        else
-        {
-            strings = readFile("swsh");
-        }
-
-        std::map<int, std::string> map;
-        for (const std::string &string : strings)
-        {
-            std::vector<std::string> entry;
-
-            std::string token;
-            std::istringstream stream(string);
-            while (std::getline(stream, token, ','))
-            {
-                entry.emplace_back(token);
-            }
-
-            map.emplace(std::stoi(entry[0]), entry[1]);
-        }
+        const auto &locations = getTable(getLocationTable(game));
+        return num < locations.size() ? locations[num] : empty;
+    }
 
-        std::vector<std::string> locations;
-        std::transform(nums.begin(), nums.end(), std::back_inserter(locations), [&map](u8 num) { return map[num]; });
+    std::vector<std::string> getLocations(const std::vector<u8> &nums, Game game)
+    {
+        const auto &locations = getTable(getLocationTable(game));
 
-        return locations;
+        std::vector<std::string> strings;
+        std::transform(nums.begin(), nums.end(), std::back_inserter(strings),
+                       [&locations](u8 num) { return num < locations.size() ? locations[num] : empty; });
+        return strings;
     }
 
-    std::string getKeypress(u8 keypress)
+    const std::string &getKeypress(u8 keypress)
     {
         return buttons[keypress];
     }
-
     std::string getKeypresses(u16 keypresses)
     {
         if (keypresses == 0)
@@ -29,18 +29,19 @@ enum Game : u32;
 namespace Translator
 {
     void init(const std::string &locale);
-    std::vector<std::string> getCharacteristic();
-    std::vector<std::string> getNatures();
-    std::string getNature(u8 nature);
-    std::string getAbility(u16 ability);
-    std::vector<std::string> getHiddenPowers();
-    std::string getHiddenPower(u8 power);
-    std::string getSpecies(u16 specie);
+    const std::vector<std::string> &getCharacteristic();
+    const std::vector<std::string> &getNatures();
+    const std::string &getNature(u8 nature);
+    const std::string &getAbility(u16 ability);
+    const std::vector<std::string> &getHiddenPowers();
+    const std::string &getHiddenPower(u8 power);
+    const std::string &getSpecies(u16 specie);
     std::vector<std::string> getSpecies(const std::vector<u16> &nums);
-    std::string getGender(u8 gender);
-    std::vector<std::string> getGenders();
+    const std::string &getGender(u8 gender);
+    const std::vector<std::string> &getGenders();
+    const std::string &getLocation(u8 num, Game game);
     std::vector<std::string> getLocations(const std::vector<u8> &nums, Game game);
-    std::string getKeypress(u8 keypress);
+    const std::string &getKeypress(u8 keypress);
     std::string getKeypresses(u16 keypresses);
 }
 
@@ -186,7 +186,7 @@ void Eggs3::emeraldGenerate()
     generator.setCompatability(ui->comboBoxEmeraldCompatibility->getCurrentByte());
 
     auto states = generator.generate();
-    emerald->addItems(states);
+    emerald->addItems(std::move(states));
 }
 
 void Eggs3::rsGenerate()
@@ -216,7 +216,7 @@ void Eggs3::rsGenerate()
     generator.setMaxAdvancesPickup(ui->textBoxRSMaxAdvancesPickup->getUInt());
 
     auto states = generator.generate(ui->textBoxRSSeedHeld->getUInt(), ui->textBoxRSSeedPickup->getUInt());
-    rs->addItems(states);
+    rs->addItems(std::move(states));
 }
 
 void Eggs3::frlgGenerate()
@@ -248,7 +248,7 @@ void Eggs3::frlgGenerate()
     generator.setMaxAdvancesPickup(ui->textBoxFRLGMaxAdvancesPickup->getUInt());
 
     auto states = generator.generate(ui->textBoxFRLGSeedHeld->getUInt(), ui->textBoxFRLGSeedPickup->getUInt());
-    frlg->addItems(states);
+    frlg->addItems(std::move(states));
 }
 
 void Eggs3::profilesIndexChanged(int index)
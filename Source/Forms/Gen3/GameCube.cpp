@@ -161,7 +161,7 @@ void GameCube::generate()
     }
 
     auto states = generator.generate(seed);
-    generatorModel->addItems(states);
+    generatorModel->addItems(std::move(states));
 }
 
 void GameCube::search()
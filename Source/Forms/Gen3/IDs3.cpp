@@ -117,7 +117,7 @@ void IDs3::xdColoSearch()
     IDGenerator3 generator(initialAdvances, maxAdvances, filter);
 
     auto states = generator.generateXDColo(seed);
-    xdcolo->addItems(states);
+    xdcolo->addItems(std::move(states));
 }
 
 void IDs3::frlgeSearch()
@@ -146,7 +146,7 @@ void IDs3::frlgeSearch()
     IDGenerator3 generator(initialAdvances, maxAdvances, filter);
 
     auto states = generator.generateFRLGE(tid);
-    frlge->addItems(states);
+    frlge->addItems(std::move(states));
 }
 
 void IDs3::rsSearch()
@@ -194,7 +194,7 @@ void IDs3::rsSearch()
     IDGenerator3 generator(initialAdvances, maxAdvances, filter);
 
     auto states = generator.generateRS(seed);
-    rs->addItems(states);
+    rs->addItems(std::move(states));
 }
 
 void IDs3::rsDeadBattery(bool checked)
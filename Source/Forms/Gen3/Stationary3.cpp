@@ -145,7 +145,7 @@ void Stationary3::generate()
     generator.setOffset(offset);
 
     auto states = generator.generate(seed);
-    generatorModel->addItems(states);
+    generatorModel->addItems(std::move(states));
 }
 
 void Stationary3::search()
@@ -63,5 +63,5 @@ void PIDIV::generate()
 
     u32 pid = ui->textBoxPID->getUInt();
     auto states = PIDIVCalculator::calculateIVs(pid);
-    model->addItems(states);
+    model->addItems(std::move(states));
 }
@@ -106,7 +106,7 @@ void PokeSpot::generate()
     PokeSpotGenerator generator(initialAdvances, maxAdvances, tid, sid, genderRatio, filter);
 
     auto states = generator.generate(seed, ui->comboBoxSpotType->getChecked());
-    model->addItems(states);
+    model->addItems(std::move(states));
 }
 
 void PokeSpot::tableViewContextMenu(QPoint pos)
@@ -107,5 +107,5 @@ void SeedTime3::find()
 
     model->clearModel();
     auto states = SeedTimeCalculator3::calculateTimes(seed, advance, year);
-    model->addItems(states);
+    model->addItems(std::move(states));
 }
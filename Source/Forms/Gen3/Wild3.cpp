@@ -256,7 +256,7 @@ void Wild3::generate()
     }
 
     auto states = generator.generate(seed, encounterGenerator[ui->comboBoxGeneratorLocation->currentData().toInt()]);
-    generatorModel->addItems(states);
+    generatorModel->addItems(std::move(states));
 }
 
 void Wild3::search()
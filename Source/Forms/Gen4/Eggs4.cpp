@@ -210,7 +210,7 @@ void Eggs4::generate()
     EggGenerator4 generator(initialAdvances, maxAdvances, tid, sid, ui->filterGenerator->getGenderRatio(), method, filter, daycare);
 
     auto states = generator.generate(seed);
-    generatorModel->addItems(states);
+    generatorModel->addItems(std::move(states));
 }
 
 void Eggs4::search()
@@ -269,8 +269,11 @@ void Eggs4::search()
 
     auto *searcher = new EggSearcher4(tid, sid, genderRatio, methodModel, filter);
 
-    auto *thread = QThread::create(
-        [=] { searcher->startSearch(minDelay, maxDelay, ui->comboBoxSearcherMethod->currentIndex(), generatorIV, generatorPID); });
+    QSettings settings;
+    int threads = settings.value("settings/threads").toInt();
+    int type = ui->comboBoxSearcherMethod->currentIndex();
+
+    auto *thread = QThread::create([=] { searcher->startSearch(threads, minDelay, maxDelay, type, generatorIV, generatorPID); });
     connect(thread, &QThread::finished, thread, &QThread::deleteLater);
     connect(ui->pushButtonCancel, &QPushButton::clicked, [searcher] { searcher->cancelSearch(); });
 
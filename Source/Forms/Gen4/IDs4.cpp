@@ -200,5 +200,5 @@ void IDs4::seedFinderSearch()
     IDFilter filter({ ui->textBoxSeedFinderTID->getUShort() }, std::vector<u16>(), std::vector<u16>());
 
     auto states = generator.generate(filter);
-    seedFinder->addItems(states);
+    seedFinder->addItems(std::move(states));
 }
@@ -191,7 +191,7 @@ void Stationary4::generate()
     }
 
     auto states = generator.generate(seed);
-    generatorModel->addItems(states);
+    generatorModel->addItems(std::move(states));
 }
 
 void Stationary4::search()
@@ -19,13 +19,12 @@
 
 #include "SearchCalls.hpp"
 #include "ui_SearchCalls.h"
-#include <Core/Util/Utilities.hpp>
 #include <QSettings>
 #include <algorithm>
 
 SearchCalls::SearchCalls(const std::vector<SeedTime> &model, const std::vector<bool> &roamers, const std::vector<u8> &routes,
                          QWidget *parent) :
-    QDialog(parent), ui(new Ui::SearchCalls)
+    QDialog(parent), ui(new Ui::SearchCalls), index(model)
 {
     ui->setupUi(this);
     setAttribute(Qt::WA_QuitOnClose, false);
@@ -33,7 +32,6 @@ SearchCalls::SearchCalls(const std::vector<SeedTime> &model, const std::vector<b
     this->roamers = roamers;
     this->routes = routes;
 
-    data = model;
     ui->labelPossibleResults->setText(tr("Possible Results: ") + QString::number(model.size()));
 
     connect(ui->pushButtonE, &QPushButton::clicked, this, &SearchCalls::e);
@@ -91,39 +89,16 @@ void SearchCalls::callsTextChanged(const QString &val)
         QString result = val;
         result.replace(" ", "").replace(",", "");
 
-        int num = 0;
-
-        possible.clear();
-        for (const auto &dt : data)
+        std::vector<u8> sequence;
+        for (QChar c : result)
         {
-            std::string compare = dt.getSequence();
-            if (compare.find("skipped") != std::string::npos)
-            {
-                size_t index = compare.find(')');
-                compare = compare.substr(index, compare.size() - index);
-            }
-
-            for (size_t i = 0; i < compare.size();)
-            {
-                auto c = compare[i];
-                if (c == ' ' || c == ',')
-                {
-                    compare.erase(compare.begin() + i);
-                }
-                else
-                {
-                    i++;
-                }
-            }
-
-            bool pass = compare.find(result.toStdString()) != std::string::npos;
-            possible.emplace_back(pass);
-            if (pass)
-            {
-                num++;
-            }
+            int symbol = QString("EKP").indexOf(c);
+            sequence.emplace_back(symbol == -1 ? 0xff : symbol);
         }
 
+        possible = index.search(sequence);
+        int num = std::count(possible.begin(), possible.end(), true);
+
         ui->labelPossibleResults->setText(tr("Possible Results: ") + QString::number(num));
     }
 }
@@ -21,6 +21,7 @@
 #define SEARCHCALLS_HPP
 
 #include <Core/Gen4/SeedTime.hpp>
+#include <Core/Gen4/Tools/SequenceIndex4.hpp>
 #include <QDialog>
 
 namespace Ui
@@ -39,7 +40,7 @@ public:
 
 private:
     Ui::SearchCalls *ui;
-    std::vector<SeedTime> data;
+    SequenceIndex4 index;
     std::vector<bool> possible;
     std::vector<bool> roamers;
     std::vector<u8> routes;
@@ -19,15 +19,15 @@
 
 #include "SearchCoinFlips.hpp"
 #include "ui_SearchCoinFlips.h"
-#include <Core/Util/Utilities.hpp>
 #include <QSettings>
+#include <algorithm>
 
-SearchCoinFlips::SearchCoinFlips(const std::vector<SeedTime> &model, QWidget *parent) : QDialog(parent), ui(new Ui::SearchCoinFlips)
+SearchCoinFlips::SearchCoinFlips(const std::vector<SeedTime> &model, QWidget *parent) :
+    QDialog(parent), ui(new Ui::SearchCoinFlips), index(model)
 {
     ui->setupUi(this);
     setAttribute(Qt::WA_QuitOnClose, false);
 
-    data = model;
     ui->labelPossibleResults->setText(tr("Possible Results: ") + QString::number(model.size()));
 
     connect(ui->pushButtonHeads, &QPushButton::clicked, this, &SearchCoinFlips::heads);
@@ -74,33 +74,17 @@ void SearchCoinFlips::flipsTextChanged(const QString &val)
     {
         QString result = val;
         result.replace(" ", "").replace(",", "");
-        int num = 0;
 
-        possible.clear();
-        for (const auto &dt : data)
+        std::vector<u8> sequence;
+        for (QChar c : result)
         {
-            std::string compare = dt.getSequence();
-            for (size_t i = 0; i < compare.size();)
-            {
-                auto c = compare[i];
-                if (c == ' ' || c == ',')
-                {
-                    compare.erase(compare.begin() + i);
-                }
-                else
-                {
-                    i++;
-                }
-            }
-
-            bool pass = compare.find(result.toStdString()) != std::string::npos;
-            possible.emplace_back(pass);
-            if (pass)
-            {
-                num++;
-            }
+            int symbol = QString("TH").indexOf(c);
+            sequence.emplace_back(symbol == -1 ? 0xff : symbol);
         }
 
+        possible = index.search(sequence);
+        int num = std::count(possible.begin(), possible.end(), true);
+
         ui->labelPossibleResults->setText(tr("Possible Results: ") + QString::number(num));
     }
 }
@@ -21,6 +21,7 @@
 #define SEARCHCOINFLIPS_HPP
 
 #include <Core/Gen4/SeedTime.hpp>
+#include <Core/Gen4/Tools/SequenceIndex4.hpp>
 #include <QDialog>
 
 namespace Ui
@@ -38,7 +39,7 @@ public:
 
 private:
     Ui::SearchCoinFlips *ui;
-    std::vector<SeedTime> data;
+    SequenceIndex4 index;
     std::vector<bool> possible;
 
 private slots:
@@ -253,7 +253,7 @@ void SeedtoTime4::dpptGenerate()
     std::vector<SeedTime> results = generate(seed, year, forceSecond, forcedSecond, Game::Diamond);
     ui->labelDPPtCoinFlips->setText(tr("Coin Flips: ") + QString::fromStdString(Utilities::coinFlips(seed)));
 
-    dpptModel->addItems(results);
+    dpptModel->addItems(std::move(results));
 }
 
 void SeedtoTime4::dpptCalibrate()
@@ -311,7 +311,7 @@ void SeedtoTime4::hgssGenerate()
     std::string str = info.getRouteString();
     ui->labelHGSSRoamers->setText(tr("Roamers: ") + (str.empty() ? tr("No roamers") : QString::fromStdString(str)));
 
-    hgssModel->addItems(results);
+    hgssModel->addItems(std::move(results));
 }
 
 void SeedtoTime4::hgssCalibrate()
@@ -286,7 +286,7 @@ void Wild4::generate()
     generator.setEncounterArea(encounterGenerator[ui->comboBoxGeneratorLocation->currentData().toInt()]);
 
     auto states = generator.generate(seed);
-    generatorModel->addItems(states);
+    generatorModel->addItems(std::move(states));
 }
 
 void Wild4::search()
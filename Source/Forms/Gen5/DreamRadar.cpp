@@ -225,7 +225,7 @@ void DreamRadar::generate()
     generator.setOffset(offset);
 
     auto states = generator.generate(seed, currentProfile.getMemoryLink());
-    generatorModel->addItems(states);
+    generatorModel->addItems(std::move(states));
 }
 
 void DreamRadar::search()
@@ -170,7 +170,7 @@ void Eggs5::generate()
     generator.setOffset(offset);
 
     auto states = generator.generate(seed);
-    generatorModel->addItems(states);
+    generatorModel->addItems(std::move(states));
 }
 
 void Eggs5::search()
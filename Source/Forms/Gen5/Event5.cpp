@@ -206,7 +206,7 @@ void Event5::generate()
     generator.setOffset(offset);
 
     auto states = generator.generate(seed);
-    generatorModel->addItems(states);
+    generatorModel->addItems(std::move(states));
 }
 
 void Event5::search()
@@ -170,7 +170,7 @@ void HiddenGrotto::generate()
     HiddenGrottoGenerator generator(initialAdvances, maxAdvances, genderRatio, powerLevel, filter);
 
     auto states = generator.generate(seed);
-    generatorModel->addItems(states);
+    generatorModel->addItems(std::move(states));
 }
 
 void HiddenGrotto::search()
@@ -234,7 +234,7 @@ void IDs5::find()
         }
     }
 
-    model->addItems(results);
+    model->addItems(std::move(results));
 }
 
 void IDs5::profileIndexChanged(int index)
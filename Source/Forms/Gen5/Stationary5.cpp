@@ -204,7 +204,7 @@ void Stationary5::generate()
     }
 
     auto states = generator.generate(seed);
-    generatorModel->addItems(states);
+    generatorModel->addItems(std::move(states));
 }
 
 void Stationary5::search()
@@ -57,8 +57,8 @@ void DenMap::locationIndexChanged(int index)
 
         for (u8 denID = start; denID < end; denID++)
         {
-            auto location = Translator::getLocations({DenLoader::getLocation(denID)}, Game::SwSh);
-            ui->comboBoxDen->addItem(QString("%1: %2").arg(denID + 1 - offset).arg(QString::fromStdString(location[0])));
+            const std::string &location = Translator::getLocation(DenLoader::getLocation(denID), Game::SwSh);
+            ui->comboBoxDen->addItem(QString("%1: %2").arg(denID + 1 - offset).arg(QString::fromStdString(location)));
         }
 
         denIndexChanged(0);
@@ -147,7 +147,7 @@ void Eggs8::generate()
     generator.setOffset(offset);
 
     auto states = generator.generate(seed0, seed1);
-    model->addItems(states);
+    model->addItems(std::move(states));
 }
 
 void Eggs8::profileIndexChanged(int index)
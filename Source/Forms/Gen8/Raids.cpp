@@ -136,8 +136,8 @@ void Raids::setupModels()
 
 void Raids::generate()
 {
-    Den den = DenLoader::getDen(ui->comboBoxDen->currentData().toInt(), ui->comboBoxRarity->currentIndex());
-    Raid raid = den.getRaid(static_cast<u8>(ui->comboBoxSpecies->currentIndex()), currentProfile.getVersion());
+    const Den &den = DenLoader::getDen(ui->comboBoxDen->currentData().toInt(), ui->comboBoxRarity->currentIndex());
+    const Raid &raid = den.getRaid(static_cast<u8>(ui->comboBoxSpecies->currentIndex()), currentProfile.getVersion());
     model->clearModel();
 
     u32 initialAdvances = ui->textBoxInitialAdvances->getUInt();
@@ -153,7 +153,7 @@ void Raids::generate()
     u64 seed = ui->textBoxSeed->getULong();
 
     auto states = generator.generate(seed);
-    model->addItems(states);
+    model->addItems(std::move(states));
 }
 
 void Raids::profileIndexChanged(int index)
@@ -201,8 +201,8 @@ void Raids::locationIndexChanged(int index)
                 continue;
             }
 
-            auto location = Translator::getLocations({ DenLoader::getLocation(denID) }, Game::SwSh);
-            ui->comboBoxDen->addItem(QString("%1: %2").arg(denID + 1 - offset).arg(QString::fromStdString(location[0])), denID);
+            const std::string &location = Translator::getLocation(DenLoader::getLocation(denID), Game::SwSh);
+            ui->comboBoxDen->addItem(QString("%1: %2").arg(denID + 1 - offset).arg(QString::fromStdString(location)), denID);
         }
     }
 }
@@ -211,10 +211,10 @@ void Raids::denIndexChanged(int index)
 {
     if (index >= 0)
     {
-        Den den = DenLoader::getDen(ui->comboBoxDen->currentData().toInt(), ui->comboBoxRarity->currentIndex());
+        const Den &den = DenLoader::getDen(ui->comboBoxDen->currentData().toInt(), ui->comboBoxRarity->currentIndex());
 
         ui->comboBoxSpecies->clear();
-        auto raids = den.getRaids(currentProfile.getVersion());
+        const auto &raids = den.getRaids(currentProfile.getVersion());
         for (const auto &raid : raids)
         {
             ui->comboBoxSpecies->addItem(QString("%1: %2").arg(QString::fromStdString(Translator::getSpecies(raid.getSpecies())),
@@ -235,8 +235,8 @@ void Raids::speciesIndexChanged(int index)
 {
     if (index >= 0)
     {
-        Den den = DenLoader::getDen(ui->comboBoxDen->currentData().toInt(), ui->comboBoxRarity->currentIndex());
-        Raid raid = den.getRaid(static_cast<u8>(index), currentProfile.getVersion());
+        const Den &den = DenLoader::getDen(ui->comboBoxDen->currentData().toInt(), ui->comboBoxRarity->currentIndex());
+        const Raid &raid = den.getRaid(static_cast<u8>(index), currentProfile.getVersion());
         PersonalInfo info = PersonalLoader8::getPersonal(raid.getSpecies(), raid.getAltForm());
 
         ui->spinBoxIVCount->setValue(raid.getIVCount());
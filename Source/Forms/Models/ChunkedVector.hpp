@@ -0,0 +1,253 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef CHUNKEDVECTOR_HPP
+#define CHUNKEDVECTOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Stores items in fixed size chunks so growing never relocates the existing items
+template <class Item>
+class ChunkedVector
+{
+    static constexpr size_t shift = 12;
+    static constexpr size_t chunkSize = static_cast<size_t>(1) << shift;
+    static constexpr size_t mask = chunkSize - 1;
+
+public:
+    template <bool isConst>
+    class Iterator
+    {
+        using Container = std::conditional_t<isConst, const ChunkedVector, ChunkedVector>;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = Item;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<isConst, const Item *, Item *>;
+        using reference = std::conditional_t<isConst, const Item &, Item &>;
+
+        Iterator() = default;
+
+        Iterator(Container *container, size_t index) : container(container), index(index)
+        {
+        }
+
+        reference operator*() const
+        {
+            return (*container)[index];
+        }
+
+        pointer operator->() const
+        {
+            return &(*container)[index];
+        }
+
+        reference operator[](difference_type n) const
+        {
+            return (*container)[index + n];
+        }
+
+        Iterator &operator++()
+        {
+            index++;
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator it(*this);
+            index++;
+            return it;
+        }
+
+        Iterator &operator--()
+        {
+            index--;
+            return *this;
+        }
+
+        Iterator operator--(int)
+        {
+            Iterator it(*this);
+            index--;
+            return it;
+        }
+
+        Iterator &operator+=(difference_type n)
+        {
+            index += n;
+            return *this;
+        }
+
+        Iterator &operator-=(difference_type n)
+        {
+            index -= n;
+            return *this;
+        }
+
+        Iterator operator+(difference_type n) const
+        {
+            return Iterator(container, index + n);
+        }
+
+        friend Iterator operator+(difference_type n, const Iterator &it)
+        {
+            return it + n;
+        }
+
+        Iterator operator-(difference_type n) const
+        {
+            return Iterator(container, index - n);
+        }
+
+        difference_type operator-(const Iterator &other) const
+        {
+            return static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
+        }
+
+        bool operator==(const Iterator &other) const
+        {
+            return index == other.index;
+        }
+
+        bool operator!=(const Iterator &other) const
+        {
+            return index != other.index;
+        }
+
+        bool operator<(const Iterator &other) const
+        {
+            return index < other.index;
+        }
+
+        bool operator>(const Iterator &other) const
+        {
+            return index > other.index;
+        }
+
+        bool operator<=(const Iterator &other) const
+        {
+            return index <= other.index;
+        }
+
+        bool operator>=(const Iterator &other) const
+        {
+            return index >= other.index;
+        }
+
+    private:
+        Container *container = nullptr;
+        size_t index = 0;
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    Item &operator[](size_t index)
+    {
+        return chunks[index >> shift][index & mask];
+    }
+
+    const Item &operator[](size_t index) const
+    {
+        return chunks[index >> shift][index & mask];
+    }
+
+    iterator begin()
+    {
+        return iterator(this, 0);
+    }
+
+    iterator end()
+    {
+        return iterator(this, count);
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(this, count);
+    }
+
+    size_t size() const
+    {
+        return count;
+    }
+
+    bool empty() const
+    {
+        return count == 0;
+    }
+
+    template <class... Args>
+    void emplace_back(Args &&...args)
+    {
+        if ((count & mask) == 0)
+        {
+            chunks.emplace_back();
+            chunks.back().reserve(chunkSize);
+        }
+        chunks.back().emplace_back(std::forward<Args>(args)...);
+        count++;
+    }
+
+    template <class InputIt>
+    void append(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+        {
+            emplace_back(*first);
+        }
+    }
+
+    // Shifts the following items down by one, no chunk is reallocated
+    void erase(size_t index)
+    {
+        std::move(begin() + index + 1, end(), begin() + index);
+        chunks.back().pop_back();
+        if (chunks.back().empty())
+        {
+            chunks.pop_back();
+        }
+        count--;
+    }
+
+    void clear()
+    {
+        chunks.clear();
+        chunks.shrink_to_fit();
+        count = 0;
+    }
+
+private:
+    std::vector<std::vector<Item>> chunks;
+    size_t count = 0;
+};
+
+#endif // CHUNKEDVECTOR_HPP
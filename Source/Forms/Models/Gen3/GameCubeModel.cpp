@@ -90,90 +90,53 @@ void GameCubeSearcherModel::setMethod(Method type)
 
 void GameCubeSearcherModel::sort(int column, Qt::SortOrder order)
 {
-    if (!model.empty())
+    switch (column)
     {
-        emit layoutAboutToBeChanged();
-        bool flag = order == Qt::AscendingOrder;
-        switch (column)
-        {
-        case 0:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
-                return flag ? state1.getSeed() < state2.getSeed() : state1.getSeed() > state2.getSeed();
-            });
-            break;
-        case 1:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
-                return flag ? state1.getPID() < state2.getPID() : state1.getPID() > state2.getPID();
-            });
-            break;
-        case 2:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
-                return flag ? state1.getShiny() < state2.getShiny() : state1.getShiny() > state2.getShiny();
-            });
-            break;
-        case 3:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
-                return flag ? state1.getNature() < state2.getNature() : state1.getNature() > state2.getNature();
-            });
-            break;
-        case 4:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
-                return flag ? state1.getAbility() < state2.getAbility() : state1.getAbility() > state2.getAbility();
-            });
-            break;
-        case 5:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
-                return flag ? state1.getIV(0) < state2.getIV(0) : state1.getIV(0) > state2.getIV(0);
-            });
-            break;
-        case 6:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
-                return flag ? state1.getIV(1) < state2.getIV(1) : state1.getIV(1) > state2.getIV(1);
-            });
-            break;
-        case 7:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
-                return flag ? state1.getIV(2) < state2.getIV(2) : state1.getIV(2) > state2.getIV(2);
-            });
-            break;
-        case 8:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
-                return flag ? state1.getIV(3) < state2.getIV(3) : state1.getIV(3) > state2.getIV(3);
-            });
-            break;
-        case 9:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
-                return flag ? state1.getIV(4) < state2.getIV(4) : state1.getIV(4) > state2.getIV(4);
-            });
-            break;
-        case 10:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
-                return flag ? state1.getIV(5) < state2.getIV(5) : state1.getIV(5) > state2.getIV(5);
-            });
-            break;
-        case 11:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
-                return flag ? state1.getHidden() < state2.getHidden() : state1.getHidden() > state2.getHidden();
-            });
-            break;
-        case 12:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
-                return flag ? state1.getPower() < state2.getPower() : state1.getPower() > state2.getPower();
-            });
-            break;
-        case 13:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
-                return flag ? state1.getGender() < state2.getGender() : state1.getGender() > state2.getGender();
-            });
-            break;
-        case 14:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
-                return flag ? state1.getInfo() < state2.getInfo() : state1.getInfo() > state2.getInfo();
-            });
-            break;
-        }
-
-        emit layoutChanged();
+    case 0:
+        sortItems(order, [](const GameCubeState &state) { return state.getSeed(); });
+        break;
+    case 1:
+        sortItems(order, [](const GameCubeState &state) { return state.getPID(); });
+        break;
+    case 2:
+        sortItems(order, [](const GameCubeState &state) { return state.getShiny(); });
+        break;
+    case 3:
+        sortItems(order, [](const GameCubeState &state) { return state.getNature(); });
+        break;
+    case 4:
+        sortItems(order, [](const GameCubeState &state) { return state.getAbility(); });
+        break;
+    case 5:
+        sortItems(order, [](const GameCubeState &state) { return state.getIV(0); });
+        break;
+    case 6:
+        sortItems(order, [](const GameCubeState &state) { return state.getIV(1); });
+        break;
+    case 7:
+        sortItems(order, [](const GameCubeState &state) { return state.getIV(2); });
+        break;
+    case 8:
+        sortItems(order, [](const GameCubeState &state) { return state.getIV(3); });
+        break;
+    case 9:
+        sortItems(order, [](const GameCubeState &state) { return state.getIV(4); });
+        break;
+    case 10:
+        sortItems(order, [](const GameCubeState &state) { return state.getIV(5); });
+        break;
+    case 11:
+        sortItems(order, [](const GameCubeState &state) { return state.getHidden(); });
+        break;
+    case 12:
+        sortItems(order, [](const GameCubeState &state) { return state.getPower(); });
+        break;
+    case 13:
+        sortItems(order, [](const GameCubeState &state) { return state.getGender(); });
+        break;
+    case 14:
+        sortItems(order, [](const GameCubeState &state) { return state.getInfo(); });
+        break;
     }
 }
 
@@ -83,66 +83,40 @@ StationarySearcherModel3::StationarySearcherModel3(QObject *parent) : TableModel
 
 void StationarySearcherModel3::sort(int column, Qt::SortOrder order)
 {
-    if (!model.empty())
+    switch (column)
     {
-        emit layoutAboutToBeChanged();
-        bool flag = order == Qt::AscendingOrder;
-        switch (column)
-        {
-        case 0:
-            std::sort(model.begin(), model.end(), [flag](const State &state1, const State &state2) {
-                return flag ? state1.getSeed() < state2.getSeed() : state1.getSeed() > state2.getSeed();
-            });
-            break;
-        case 1:
-            std::sort(model.begin(), model.end(), [flag](const State &state1, const State &state2) {
-                return flag ? state1.getPID() < state2.getPID() : state1.getPID() > state2.getPID();
-            });
-            break;
-        case 2:
-            std::sort(model.begin(), model.end(), [flag](const State &state1, const State &state2) {
-                return flag ? state1.getShiny() < state2.getShiny() : state1.getShiny() > state2.getShiny();
-            });
-            break;
-        case 3:
-            std::sort(model.begin(), model.end(), [flag](const State &state1, const State &state2) {
-                return flag ? state1.getNature() < state2.getNature() : state1.getNature() > state2.getNature();
-            });
-            break;
-        case 4:
-            std::sort(model.begin(), model.end(), [flag](const State &state1, const State &state2) {
-                return flag ? state1.getAbility() < state2.getAbility() : state1.getAbility() > state2.getAbility();
-            });
-            break;
-        case 5:
-        case 6:
-        case 7:
-        case 8:
-        case 9:
-        case 10:
-            std::sort(model.begin(), model.end(), [flag, column](const State &state1, const State &state2) {
-                return flag ? state1.getIV(static_cast<u8>(column - 5)) < state2.getIV(static_cast<u8>(column - 5))
-                            : state1.getIV(static_cast<u8>(column - 5)) > state2.getIV(static_cast<u8>(column - 5));
-            });
-            break;
-        case 11:
-            std::sort(model.begin(), model.end(), [flag](const State &state1, const State &state2) {
-                return flag ? state1.getHidden() < state2.getHidden() : state1.getHidden() > state2.getHidden();
-            });
-            break;
-        case 12:
-            std::sort(model.begin(), model.end(), [flag](const State &state1, const State &state2) {
-                return flag ? state1.getPower() < state2.getPower() : state1.getPower() > state2.getPower();
-            });
-            break;
-        case 13:
-            std::sort(model.begin(), model.end(), [flag](const State &state1, const State &state2) {
-                return flag ? state1.getGender() < state2.getGender() : state1.getGender() > state2.getGender();
-            });
-            break;
-        }
-
-        emit layoutChanged();
+    case 0:
+        sortItems(order, [](const State &state) { return state.getSeed(); });
+        break;
+    case 1:
+        sortItems(order, [](const State &state) { return state.getPID(); });
+        break;
+    case 2:
+        sortItems(order, [](const State &state) { return state.getShiny(); });
+        break;
+    case 3:
+        sortItems(order, [](const State &state) { return state.getNature(); });
+        break;
+    case 4:
+        sortItems(order, [](const State &state) { return state.getAbility(); });
+        break;
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+        sortItems(order, [column](const State &state) { return state.getIV(static_cast<u8>(column - 5)); });
+        break;
+    case 11:
+        sortItems(order, [](const State &state) { return state.getHidden(); });
+        break;
+    case 12:
+        sortItems(order, [](const State &state) { return state.getPower(); });
+        break;
+    case 13:
+        sortItems(order, [](const State &state) { return state.getGender(); });
+        break;
     }
 }
 
@@ -88,81 +88,49 @@ WildSearcherModel3::WildSearcherModel3(QObject *parent) : TableModel<WildState>(
 
 void WildSearcherModel3::sort(int column, Qt::SortOrder order)
 {
-    if (!model.empty())
+    switch (column)
     {
-        emit layoutAboutToBeChanged();
-        bool flag = order == Qt::AscendingOrder;
-        switch (column)
-        {
-        case 0:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
-                return flag ? state1.getSeed() < state2.getSeed() : state1.getSeed() > state2.getSeed();
-            });
-            break;
-        case 1:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
-                return flag ? state1.getLead() < state2.getLead() : state1.getLead() > state2.getLead();
-            });
-            break;
-        case 2:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
-                return flag ? state1.getEncounterSlot() < state2.getEncounterSlot() : state1.getEncounterSlot() > state2.getEncounterSlot();
-            });
-            break;
-        case 3:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
-                return flag ? state1.getLevel() < state2.getLevel() : state1.getLevel() > state2.getLevel();
-            });
-            break;
-        case 4:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
-                return flag ? state1.getPID() < state2.getPID() : state1.getPID() > state2.getPID();
-            });
-            break;
-        case 5:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
-                return flag ? state1.getShiny() < state2.getShiny() : state1.getShiny() > state2.getShiny();
-            });
-            break;
-        case 6:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
-                return flag ? state1.getNature() < state2.getNature() : state1.getNature() > state2.getNature();
-            });
-            break;
-        case 7:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
-                return flag ? state1.getAbility() < state2.getAbility() : state1.getAbility() > state2.getAbility();
-            });
-            break;
-        case 8:
-        case 9:
-        case 10:
-        case 11:
-        case 12:
-        case 13:
-            std::sort(model.begin(), model.end(), [flag, column](const WildState &state1, const WildState &state2) {
-                return flag ? state1.getIV(static_cast<u8>(column - 8)) < state2.getIV(static_cast<u8>(column - 8))
-                            : state1.getIV(static_cast<u8>(column - 8)) > state2.getIV(static_cast<u8>(column - 8));
-            });
-            break;
-        case 14:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
-                return flag ? state1.getHidden() < state2.getHidden() : state1.getHidden() > state2.getHidden();
-            });
-            break;
-        case 15:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
-                return flag ? state1.getPower() < state2.getPower() : state1.getPower() > state2.getPower();
-            });
-            break;
-        case 16:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
-                return flag ? state1.getGender() < state2.getGender() : state1.getGender() > state2.getGender();
-            });
-            break;
-        }
-
-        emit layoutChanged();
+    case 0:
+        sortItems(order, [](const WildState &state) { return state.getSeed(); });
+        break;
+    case 1:
+        sortItems(order, [](const WildState &state) { return state.getLead(); });
+        break;
+    case 2:
+        sortItems(order, [](const WildState &state) { return state.getEncounterSlot(); });
+        break;
+    case 3:
+        sortItems(order, [](const WildState &state) { return state.getLevel(); });
+        break;
+    case 4:
+        sortItems(order, [](const WildState &state) { return state.getPID(); });
+        break;
+    case 5:
+        sortItems(order, [](const WildState &state) { return state.getShiny(); });
+        break;
+    case 6:
+        sortItems(order, [](const WildState &state) { return state.getNature(); });
+        break;
+    case 7:
+        sortItems(order, [](const WildState &state) { return state.getAbility(); });
+        break;
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+        sortItems(order, [column](const WildState &state) { return state.getIV(static_cast<u8>(column - 8)); });
+        break;
+    case 14:
+        sortItems(order, [](const WildState &state) { return state.getHidden(); });
+        break;
+    case 15:
+        sortItems(order, [](const WildState &state) { return state.getPower(); });
+        break;
+    case 16:
+        sortItems(order, [](const WildState &state) { return state.getGender(); });
+        break;
     }
 }
 
@@ -153,78 +153,47 @@ void EggSearcherModel4::setMethod(Method method)
 
 void EggSearcherModel4::sort(int column, Qt::SortOrder order)
 {
-    if (!model.empty())
+    switch (column)
     {
-        emit layoutAboutToBeChanged();
-        bool flag = order == Qt::AscendingOrder;
-        switch (column)
-        {
-        case 0:
-            std::sort(model.begin(), model.end(), [flag](const EggState4 &state1, const EggState4 &state2) {
-                return flag ? state1.getInitialSeed() < state2.getInitialSeed() : state1.getInitialSeed() > state2.getInitialSeed();
-            });
-            break;
-        case 1:
-        case 2:
-            std::sort(model.begin(), model.end(), [flag](const EggState4 &state1, const EggState4 &state2) {
-                return flag ? state1.getAdvances() < state2.getAdvances() : state1.getAdvances() > state2.getAdvances();
-            });
-            break;
-        case 3:
-            std::sort(model.begin(), model.end(), [flag](const EggState4 &state1, const EggState4 &state2) {
-                return flag ? state1.getSecondaryAdvance() < state2.getSecondaryAdvance()
-                            : state1.getSecondaryAdvance() > state2.getSecondaryAdvance();
-            });
-            break;
-        case 4:
-            std::sort(model.begin(), model.end(), [flag](const EggState4 &state1, const EggState4 &state2) {
-                return flag ? state1.getPID() < state2.getPID() : state1.getPID() > state2.getPID();
-            });
-            break;
-        case 5:
-            std::sort(model.begin(), model.end(), [flag](const EggState4 &state1, const EggState4 &state2) {
-                return flag ? state1.getShiny() < state2.getShiny() : state1.getShiny() > state2.getShiny();
-            });
-            break;
-        case 6:
-            std::sort(model.begin(), model.end(), [flag](const EggState4 &state1, const EggState4 &state2) {
-                return flag ? state1.getNature() < state2.getNature() : state1.getNature() > state2.getNature();
-            });
-            break;
-        case 7:
-            std::sort(model.begin(), model.end(), [flag](const EggState4 &state1, const EggState4 &state2) {
-                return flag ? state1.getAbility() < state2.getAbility() : state1.getAbility() > state2.getAbility();
-            });
-            break;
-        case 8:
-        case 9:
-        case 10:
-        case 11:
-        case 12:
-        case 13:
-            std::sort(model.begin(), model.end(), [flag, column](const EggState4 &state1, const EggState4 &state2) {
-                return flag ? state1.getIV(static_cast<u8>(column - 8)) < state2.getIV(static_cast<u8>(column - 8))
-                            : state1.getIV(static_cast<u8>(column - 8)) > state2.getIV(static_cast<u8>(column - 8));
-            });
-            break;
-        case 14:
-            std::sort(model.begin(), model.end(), [flag](const EggState4 &state1, const EggState4 &state2) {
-                return flag ? state1.getHidden() < state2.getHidden() : state1.getHidden() > state2.getHidden();
-            });
-            break;
-        case 15:
-            std::sort(model.begin(), model.end(), [flag](const EggState4 &state1, const EggState4 &state2) {
-                return flag ? state1.getPower() < state2.getPower() : state1.getPower() > state2.getPower();
-            });
-            break;
-        case 16:
-            std::sort(model.begin(), model.end(), [flag](const EggState4 &state1, const EggState4 &state2) {
-                return flag ? state1.getGender() < state2.getGender() : state1.getGender() > state2.getGender();
-            });
-            break;
-        }
-
-        emit layoutChanged();
+    case 0:
+        sortItems(order, [](const EggState4 &state) { return state.getInitialSeed(); });
+        break;
+    case 1:
+    case 2:
+        sortItems(order, [](const EggState4 &state) { return state.getAdvances(); });
+        break;
+    case 3:
+        sortItems(order, [](const EggState4 &state) { return state.getSecondaryAdvance(); });
+        break;
+    case 4:
+        sortItems(order, [](const EggState4 &state) { return state.getPID(); });
+        break;
+    case 5:
+        sortItems(order, [](const EggState4 &state) { return state.getShiny(); });
+        break;
+    case 6:
+        sortItems(order, [](const EggState4 &state) { return state.getNature(); });
+        break;
+    case 7:
+        sortItems(order, [](const EggState4 &state) { return state.getAbility(); });
+        break;
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+        sortItems(order, [column](const EggState4 &state) { return state.getIV(static_cast<u8>(column - 8)); });
+        break;
+    case 14:
+        sortItems(order, [](const EggState4 &state) { return state.getHidden(); });
+        break;
+    case 15:
+        sortItems(order, [](const EggState4 &state) { return state.getPower(); });
+        break;
+    case 16:
+        sortItems(order, [](const EggState4 &state) { return state.getGender(); });
+        break;
     }
 }
 
@@ -136,78 +136,47 @@ void StationarySearcherModel4::setMethod(Method method)
 
 void StationarySearcherModel4::sort(int column, Qt::SortOrder order)
 {
-    if (!model.empty())
+    column = getColumn(column);
+    switch (column)
     {
-        emit layoutAboutToBeChanged();
-        bool flag = order == Qt::AscendingOrder;
-
-        column = getColumn(column);
-        switch (column)
-        {
-        case 0:
-            std::sort(model.begin(), model.end(), [flag](const StationaryState &state1, const StationaryState &state2) {
-                return flag ? state1.getSeed() < state2.getSeed() : state1.getSeed() > state2.getSeed();
-            });
-            break;
-        case 1:
-            std::sort(model.begin(), model.end(), [flag](const StationaryState &state1, const StationaryState &state2) {
-                return flag ? state1.getAdvances() < state2.getAdvances() : state1.getAdvances() > state2.getAdvances();
-            });
-            break;
-        case 2:
-            std::sort(model.begin(), model.end(), [flag](const StationaryState &state1, const StationaryState &state2) {
-                return flag ? state1.getLead() < state2.getLead() : state1.getLead() > state2.getLead();
-            });
-            break;
-        case 3:
-            std::sort(model.begin(), model.end(), [flag](const StationaryState &state1, const StationaryState &state2) {
-                return flag ? state1.getPID() < state2.getPID() : state1.getPID() > state2.getPID();
-            });
-            break;
-        case 4:
-            std::sort(model.begin(), model.end(), [flag](const StationaryState &state1, const StationaryState &state2) {
-                return flag ? state1.getShiny() < state2.getShiny() : state1.getShiny() > state2.getShiny();
-            });
-            break;
-        case 5:
-            std::sort(model.begin(), model.end(), [flag](const StationaryState &state1, const StationaryState &state2) {
-                return flag ? state1.getNature() < state2.getNature() : state1.getNature() > state2.getNature();
-            });
-            break;
-        case 6:
-            std::sort(model.begin(), model.end(), [flag](const StationaryState &state1, const StationaryState &state2) {
-                return flag ? state1.getAbility() < state2.getAbility() : state1.getAbility() > state2.getAbility();
-            });
-            break;
-        case 7:
-        case 8:
-        case 9:
-        case 10:
-        case 11:
-        case 12:
-            std::sort(model.begin(), model.end(), [flag, column](const StationaryState &state1, const StationaryState &state2) {
-                return flag ? state1.getIV(static_cast<u8>(column - 7)) < state2.getIV(static_cast<u8>(column - 7))
-                            : state1.getIV(static_cast<u8>(column - 7)) > state2.getIV(static_cast<u8>(column - 7));
-            });
-            break;
-        case 13:
-            std::sort(model.begin(), model.end(), [flag](const StationaryState &state1, const StationaryState &state2) {
-                return flag ? state1.getHidden() < state2.getHidden() : state1.getHidden() > state2.getHidden();
-            });
-            break;
-        case 14:
-            std::sort(model.begin(), model.end(), [flag](const StationaryState &state1, const StationaryState &state2) {
-                return flag ? state1.getPower() < state2.getPower() : state1.getPower() > state2.getPower();
-            });
-            break;
-        case 15:
-            std::sort(model.begin(), model.end(), [flag](const StationaryState &state1, const StationaryState &state2) {
-                return flag ? state1.getGender() < state2.getGender() : state1.getGender() > state2.getGender();
-            });
-            break;
-        }
-
-        emit layoutChanged();
+    case 0:
+        sortItems(order, [](const StationaryState &state) { return state.getSeed(); });
+        break;
+    case 1:
+        sortItems(order, [](const StationaryState &state) { return state.getAdvances(); });
+        break;
+    case 2:
+        sortItems(order, [](const StationaryState &state) { return state.getLead(); });
+        break;
+    case 3:
+        sortItems(order, [](const StationaryState &state) { return state.getPID(); });
+        break;
+    case 4:
+        sortItems(order, [](const StationaryState &state) { return state.getShiny(); });
+        break;
+    case 5:
+        sortItems(order, [](const StationaryState &state) { return state.getNature(); });
+        break;
+    case 6:
+        sortItems(order, [](const StationaryState &state) { return state.getAbility(); });
+        break;
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+        sortItems(order, [column](const StationaryState &state) { return state.getIV(static_cast<u8>(column - 7)); });
+        break;
+    case 13:
+        sortItems(order, [](const StationaryState &state) { return state.getHidden(); });
+        break;
+    case 14:
+        sortItems(order, [](const StationaryState &state) { return state.getPower(); });
+        break;
+    case 15:
+        sortItems(order, [](const StationaryState &state) { return state.getGender(); });
+        break;
     }
 }
 
@@ -145,91 +145,56 @@ void WildSearcherModel4::setMethod(Method method)
 
 void WildSearcherModel4::sort(int column, Qt::SortOrder order)
 {
-    if (!model.empty())
+    switch (column)
     {
-        emit layoutAboutToBeChanged();
-        bool flag = order == Qt::AscendingOrder;
-        switch (column)
-        {
-        case 0:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
-                return flag ? state1.getSeed() < state2.getSeed() : state1.getSeed() > state2.getSeed();
-            });
-            break;
-        case 1:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
-                return flag ? state1.getAdvances() < state2.getAdvances() : state1.getAdvances() > state2.getAdvances();
-            });
-            break;
-        case 2:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
-                return flag ? state1.getLead() < state2.getLead() : state1.getLead() > state2.getLead();
-            });
-            break;
-        case 3:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
-                return flag ? state1.getItem() > state2.getItem() : state1.getItem() < state2.getItem();
-            });
-            break;
-        case 4:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
-                return flag ? state1.getEncounterSlot() < state2.getEncounterSlot() : state1.getEncounterSlot() > state2.getEncounterSlot();
-            });
-            break;
-        case 5:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
-                return flag ? state1.getLevel() < state2.getLevel() : state1.getLevel() > state2.getLevel();
-            });
-            break;
-        case 6:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
-                return flag ? state1.getPID() < state2.getPID() : state1.getPID() > state2.getPID();
-            });
-            break;
-        case 7:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
-                return flag ? state1.getShiny() < state2.getShiny() : state1.getShiny() > state2.getShiny();
-            });
-            break;
-        case 8:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
-                return flag ? state1.getNature() < state2.getNature() : state1.getNature() > state2.getNature();
-            });
-            break;
-        case 9:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
-                return flag ? state1.getAbility() < state2.getAbility() : state1.getAbility() > state2.getAbility();
-            });
-            break;
-        case 10:
-        case 11:
-        case 12:
-        case 13:
-        case 14:
-        case 15:
-            std::sort(model.begin(), model.end(), [flag, column](const WildState &state1, const WildState &state2) {
-                return flag ? state1.getIV(static_cast<u8>(column - 10)) < state2.getIV(static_cast<u8>(column - 10))
-                            : state1.getIV(static_cast<u8>(column - 10)) > state2.getIV(static_cast<u8>(column - 10));
-            });
-            break;
-        case 16:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
-                return flag ? state1.getHidden() < state2.getHidden() : state1.getHidden() > state2.getHidden();
-            });
-            break;
-        case 17:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
-                return flag ? state1.getPower() < state2.getPower() : state1.getPower() > state2.getPower();
-            });
-            break;
-        case 18:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
-                return flag ? state1.getGender() < state2.getGender() : state1.getGender() > state2.getGender();
-            });
-            break;
-        }
-
-        emit layoutChanged();
+    case 0:
+        sortItems(order, [](const WildState &state) { return state.getSeed(); });
+        break;
+    case 1:
+        sortItems(order, [](const WildState &state) { return state.getAdvances(); });
+        break;
+    case 2:
+        sortItems(order, [](const WildState &state) { return state.getLead(); });
+        break;
+    case 3:
+        sortItems(order == Qt::AscendingOrder ? Qt::DescendingOrder : Qt::AscendingOrder,
+                  [](const WildState &state) { return state.getItem(); });
+        break;
+    case 4:
+        sortItems(order, [](const WildState &state) { return state.getEncounterSlot(); });
+        break;
+    case 5:
+        sortItems(order, [](const WildState &state) { return state.getLevel(); });
+        break;
+    case 6:
+        sortItems(order, [](const WildState &state) { return state.getPID(); });
+        break;
+    case 7:
+        sortItems(order, [](const WildState &state) { return state.getShiny(); });
+        break;
+    case 8:
+        sortItems(order, [](const WildState &state) { return state.getNature(); });
+        break;
+    case 9:
+        sortItems(order, [](const WildState &state) { return state.getAbility(); });
+        break;
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
+    case 15:
+        sortItems(order, [column](const WildState &state) { return state.getIV(static_cast<u8>(column - 10)); });
+        break;
+    case 16:
+        sortItems(order, [](const WildState &state) { return state.getHidden(); });
+        break;
+    case 17:
+        sortItems(order, [](const WildState &state) { return state.getPower(); });
+        break;
+    case 18:
+        sortItems(order, [](const WildState &state) { return state.getGender(); });
+        break;
     }
 }
 
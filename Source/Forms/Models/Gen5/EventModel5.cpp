@@ -95,92 +95,52 @@ EventSearcherModel5::EventSearcherModel5(QObject *parent) : TableModel<SearcherS
 
 void EventSearcherModel5::sort(int column, Qt::SortOrder order)
 {
-    if (!model.empty())
+    switch (column)
     {
-        emit layoutAboutToBeChanged();
-        bool flag = order == Qt::AscendingOrder;
-        switch (column)
-        {
-        case 0:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
-                return flag ? state1.getInitialSeed() < state2.getInitialSeed() : state1.getInitialSeed() > state2.getInitialSeed();
-            });
-            break;
-        case 1:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
-                return flag ? state1.getState().getAdvances() < state2.getState().getAdvances()
-                            : state1.getState().getAdvances() > state2.getState().getAdvances();
-            });
-            break;
-        case 2:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
-                return flag ? state1.getState().getPID() < state2.getState().getPID()
-                            : state1.getState().getPID() > state2.getState().getPID();
-            });
-            break;
-        case 3:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
-                return flag ? state1.getState().getShiny() < state2.getState().getShiny()
-                            : state1.getState().getShiny() > state2.getState().getShiny();
-            });
-            break;
-        case 4:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
-                return flag ? state1.getState().getNature() < state2.getState().getNature()
-                            : state1.getState().getNature() > state2.getState().getNature();
-            });
-            break;
-        case 5:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
-                return flag ? state1.getState().getAbility() < state2.getState().getAbility()
-                            : state1.getState().getAbility() > state2.getState().getAbility();
-            });
-            break;
-        case 6:
-        case 7:
-        case 8:
-        case 9:
-        case 10:
-        case 11:
-            std::sort(model.begin(), model.end(), [flag, column](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
-                return flag ? state1.getState().getIV(static_cast<u8>(column - 6)) < state2.getState().getIV(static_cast<u8>(column - 6))
-                            : state1.getState().getIV(static_cast<u8>(column - 6)) > state2.getState().getIV(static_cast<u8>(column - 6));
-            });
-            break;
-        case 12:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
-                return flag ? state1.getState().getHidden() < state2.getState().getHidden()
-                            : state1.getState().getHidden() > state2.getState().getHidden();
-            });
-            break;
-        case 13:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
-                return flag ? state1.getState().getPower() < state2.getState().getPower()
-                            : state1.getState().getPower() > state2.getState().getPower();
-            });
-            break;
-        case 14:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
-                return flag ? state1.getState().getGender() < state2.getState().getGender()
-                            : state1.getState().getGender() > state2.getState().getGender();
-            });
-            break;
-        case 15:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
-                return flag ? state1.getDateTime() < state2.getDateTime() : state1.getDateTime() > state2.getDateTime();
-            });
-            break;
-        case 16:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
-                return flag ? state1.getTimer0() < state2.getTimer0() : state1.getTimer0() > state2.getTimer0();
-            });
-            break;
-        case 17:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
-                return flag ? state1.getButtons() < state2.getButtons() : state1.getButtons() > state2.getButtons();
-            });
-            break;
-        }
+    case 0:
+        sortItems(order, [](const SearcherState5<State> &state) { return state.getInitialSeed(); });
+        break;
+    case 1:
+        sortItems(order, [](const SearcherState5<State> &state) { return state.getState().getAdvances(); });
+        break;
+    case 2:
+        sortItems(order, [](const SearcherState5<State> &state) { return state.getState().getPID(); });
+        break;
+    case 3:
+        sortItems(order, [](const SearcherState5<State> &state) { return state.getState().getShiny(); });
+        break;
+    case 4:
+        sortItems(order, [](const SearcherState5<State> &state) { return state.getState().getNature(); });
+        break;
+    case 5:
+        sortItems(order, [](const SearcherState5<State> &state) { return state.getState().getAbility(); });
+        break;
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+        sortItems(order, [column](const SearcherState5<State> &state) { return state.getState().getIV(static_cast<u8>(column - 6)); });
+        break;
+    case 12:
+        sortItems(order, [](const SearcherState5<State> &state) { return state.getState().getHidden(); });
+        break;
+    case 13:
+        sortItems(order, [](const SearcherState5<State> &state) { return state.getState().getPower(); });
+        break;
+    case 14:
+        sortItems(order, [](const SearcherState5<State> &state) { return state.getState().getGender(); });
+        break;
+    case 15:
+        sortItems(order, [](const SearcherState5<State> &state) { return state.getDateTime(); });
+        break;
+    case 16:
+        sortItems(order, [](const SearcherState5<State> &state) { return state.getTimer0(); });
+        break;
+    case 17:
+        sortItems(order, [](const SearcherState5<State> &state) { return state.getButtons(); });
+        break;
     }
 }
 
@@ -69,66 +69,32 @@ HiddenGrottoSearcherModel5::HiddenGrottoSearcherModel5(QObject *parent) : TableM
 
 void HiddenGrottoSearcherModel5::sort(int column, Qt::SortOrder order)
 {
-    if (!model.empty())
+    switch (column)
     {
-        emit layoutAboutToBeChanged();
-        bool flag = order == Qt::AscendingOrder;
-        switch (column)
-        {
-        case 0:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2) {
-                          return flag ? state1.getInitialSeed() < state2.getInitialSeed()
-                                      : state1.getInitialSeed() > state2.getInitialSeed();
-                      });
-            break;
-        case 1:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2)
-                      {
-                          return flag ? state1.getState().getAdvances() < state2.getState().getAdvances()
-                                      : state1.getState().getAdvances() > state2.getState().getAdvances();
-                      });
-            break;
-        case 2:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2)
-                      {
-                          return flag ? state1.getState().getGroup() < state2.getState().getGroup()
-                                      : state1.getState().getGroup() > state2.getState().getGroup();
-                      });
-            break;
-        case 3:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2) {
-                          return flag ? state1.getState().getSlot() < state2.getState().getSlot()
-                                      : state1.getState().getSlot() > state2.getState().getSlot();
-                      });
-            break;
-        case 4:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2)
-                      {
-                          return flag ? state1.getState().getGender() < state2.getState().getGender()
-                                      : state1.getState().getGender() > state2.getState().getGender();
-                      });
-            break;
-        case 5:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2)
-                      { return flag ? state1.getDateTime() < state2.getDateTime() : state1.getDateTime() > state2.getDateTime(); });
-            break;
-        case 6:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2)
-                      { return flag ? state1.getTimer0() < state2.getTimer0() : state1.getTimer0() > state2.getTimer0(); });
-            break;
-        case 7:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2)
-                      { return flag ? state1.getButtons() < state2.getButtons() : state1.getButtons() > state2.getButtons(); });
-            break;
-        }
+    case 0:
+        sortItems(order, [](const SearcherState5<HiddenGrottoState> &state) { return state.getInitialSeed(); });
+        break;
+    case 1:
+        sortItems(order, [](const SearcherState5<HiddenGrottoState> &state) { return state.getState().getAdvances(); });
+        break;
+    case 2:
+        sortItems(order, [](const SearcherState5<HiddenGrottoState> &state) { return state.getState().getGroup(); });
+        break;
+    case 3:
+        sortItems(order, [](const SearcherState5<HiddenGrottoState> &state) { return state.getState().getSlot(); });
+        break;
+    case 4:
+        sortItems(order, [](const SearcherState5<HiddenGrottoState> &state) { return state.getState().getGender(); });
+        break;
+    case 5:
+        sortItems(order, [](const SearcherState5<HiddenGrottoState> &state) { return state.getDateTime(); });
+        break;
+    case 6:
+        sortItems(order, [](const SearcherState5<HiddenGrottoState> &state) { return state.getTimer0(); });
+        break;
+    case 7:
+        sortItems(order, [](const SearcherState5<HiddenGrottoState> &state) { return state.getButtons(); });
+        break;
     }
 }
 
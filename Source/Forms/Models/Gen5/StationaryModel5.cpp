@@ -127,7 +127,58 @@ void StationarySearcherModel5::setMethod(Method method)
 
 void StationarySearcherModel5::sort(int column, Qt::SortOrder order)
 {
-    // TODO
+    column = getColumn(column);
+    switch (column)
+    {
+    case 0:
+        sortItems(order, [](const SearcherState5<StationaryState> &state) { return state.getInitialSeed(); });
+        break;
+    case 1:
+        sortItems(order, [](const SearcherState5<StationaryState> &state) { return state.getState().getAdvances(); });
+        break;
+    case 2:
+        sortItems(order, [](const SearcherState5<StationaryState> &state) { return state.getState().getLead(); });
+        break;
+    case 3:
+        sortItems(order, [](const SearcherState5<StationaryState> &state) { return state.getState().getPID(); });
+        break;
+    case 4:
+        sortItems(order, [](const SearcherState5<StationaryState> &state) { return state.getState().getShiny(); });
+        break;
+    case 5:
+        sortItems(order, [](const SearcherState5<StationaryState> &state) { return state.getState().getNature(); });
+        break;
+    case 6:
+        sortItems(order, [](const SearcherState5<StationaryState> &state) { return state.getState().getAbility(); });
+        break;
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+        sortItems(order,
+                  [column](const SearcherState5<StationaryState> &state) { return state.getState().getIV(static_cast<u8>(column - 7)); });
+        break;
+    case 13:
+        sortItems(order, [](const SearcherState5<StationaryState> &state) { return state.getState().getHidden(); });
+        break;
+    case 14:
+        sortItems(order, [](const SearcherState5<StationaryState> &state) { return state.getState().getPower(); });
+        break;
+    case 15:
+        sortItems(order, [](const SearcherState5<StationaryState> &state) { return state.getState().getGender(); });
+        break;
+    case 16:
+        sortItems(order, [](const SearcherState5<StationaryState> &state) { return state.getDateTime(); });
+        break;
+    case 17:
+        sortItems(order, [](const SearcherState5<StationaryState> &state) { return state.getTimer0(); });
+        break;
+    case 18:
+        sortItems(order, [](const SearcherState5<StationaryState> &state) { return state.getButtons(); });
+        break;
+    }
 }
 
 int StationarySearcherModel5::columnCount(const QModelIndex &parent) const
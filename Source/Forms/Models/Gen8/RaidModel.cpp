@@ -24,6 +24,39 @@ RaidModel::RaidModel(QObject *parent) : TableModel<State>(parent)
 {
 }
 
+void RaidModel::sort(int column, Qt::SortOrder order)
+{
+    switch (column)
+    {
+    case 0:
+        sortItems(order, [](const State &state) { return state.getAdvances(); });
+        break;
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+        sortItems(order, [column](const State &state) { return state.getIV(static_cast<u8>(column - 1)); });
+        break;
+    case 7:
+        sortItems(order, [](const State &state) { return state.getShiny(); });
+        break;
+    case 8:
+        sortItems(order, [](const State &state) { return state.getNature(); });
+        break;
+    case 9:
+        sortItems(order, [](const State &state) { return state.getAbility(); });
+        break;
+    case 10:
+        sortItems(order, [](const State &state) { return state.getGender(); });
+        break;
+    case 13:
+        sortItems(order, [](const State &state) { return state.getPID(); });
+        break;
+    }
+}
+
 int RaidModel::columnCount(const QModelIndex &parent) const
 {
     (void)parent;
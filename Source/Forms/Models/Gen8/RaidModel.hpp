@@ -28,6 +28,7 @@ class RaidModel final : public TableModel<State>
     Q_OBJECT
 public:
     RaidModel(QObject *parent = nullptr);
+    void sort(int column, Qt::SortOrder order) override final;
     int columnCount(const QModelIndex &parent = QModelIndex()) const override final;
     QVariant data(const QModelIndex &index, int role) const override final;
     QVariant headerData(int section, Qt::Orientation orientation, int role) const override final;
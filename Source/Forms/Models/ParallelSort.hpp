@@ -0,0 +1,80 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef PARALLELSORT_HPP
+#define PARALLELSORT_HPP
+
+#include <algorithm>
+#include <future>
+#include <thread>
+#include <vector>
+
+// Sorts equal slices on separate threads and then merges neighbouring slices pairwise
+template <class RandomIt, class Compare>
+void parallelSort(RandomIt first, RandomIt last, Compare compare)
+{
+    auto size = last - first;
+    unsigned int threads = std::thread::hardware_concurrency();
+    if (size < 0x10000 || threads < 2)
+    {
+        std::sort(first, last, compare);
+        return;
+    }
+
+    // Power of two slices so every merge round pairs them up evenly
+    int parts = 1;
+    while (parts * 2 <= static_cast<int>(threads))
+    {
+        parts *= 2;
+    }
+
+    std::vector<RandomIt> bounds;
+    for (int i = 0; i <= parts; i++)
+    {
+        bounds.emplace_back(first + size * i / parts);
+    }
+
+    std::vector<std::future<void>> jobs;
+    for (int i = 0; i < parts; i++)
+    {
+        jobs.emplace_back(std::async(std::launch::async, [=] { std::sort(bounds[i], bounds[i + 1], compare); }));
+    }
+
+    for (int step = 1; step < parts; step *= 2)
+    {
+        for (auto &job : jobs)
+        {
+            job.wait();
+        }
+        jobs.clear();
+
+        for (int i = 0; i < parts; i += 2 * step)
+        {
+            jobs.emplace_back(
+                std::async(std::launch::async, [=] { std::inplace_merge(bounds[i], bounds[i + step], bounds[i + 2 * step], compare); }));
+        }
+    }
+
+    for (auto &job : jobs)
+    {
+        job.wait();
+    }
+}
+
+#endif // PARALLELSORT_HPP
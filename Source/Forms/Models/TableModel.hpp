@@ -20,7 +20,14 @@
 #ifndef TABLEMODEL_HPP
 #define TABLEMODEL_HPP
 
+#include <Core/Util/Global.hpp>
+#include <Forms/Models/ChunkedVector.hpp>
+#include <Forms/Models/ParallelSort.hpp>
 #include <QAbstractTableModel>
+#include <QThread>
+#include <memory>
+#include <utility>
+#include <vector>
 
 template <class Item>
 class TableModel : public QAbstractTableModel
@@ -34,15 +41,32 @@ public:
     {
         if (!items.empty())
         {
+            invalidateSort();
             int i = rowCount();
             emit beginInsertRows(QModelIndex(), i, i + static_cast<int>(items.size()) - 1);
-            model.insert(model.end(), items.begin(), items.end());
+            model.append(items.begin(), items.end());
             emit endInsertRows();
         }
     }
 
+    void addItems(std::vector<Item> &&items)
+    {
+        if (!items.empty())
+        {
+            invalidateSort();
+            int i = rowCount();
+            emit beginInsertRows(QModelIndex(), i, i + static_cast<int>(items.size()) - 1);
+            model.append(std::make_move_iterator(items.begin()), std::make_move_iterator(items.end()));
+            emit endInsertRows();
+
+            // Release the results right away instead of when the caller goes out of scope
+            std::vector<Item>().swap(items);
+        }
+    }
+
     void addItem(const Item &item)
     {
+        invalidateSort();
         int i = rowCount();
         emit beginInsertRows(QModelIndex(), i, i);
         model.emplace_back(item);
@@ -51,35 +75,37 @@ public:
 
     void updateItem(const Item &item, int row)
     {
+        invalidateSort();
         model[row] = item;
         emit dataChanged(index(row, 0), index(row, columnCount()));
     }
 
     void removeItem(int row)
     {
+        invalidateSort();
         emit beginRemoveRows(QModelIndex(), row, row);
-        model.erase(model.begin() + row);
-        model.shrink_to_fit();
+        model.erase(row);
         emit endRemoveRows();
     }
 
-    Item getItem(int row) const
+    const Item &getItem(int row) const
     {
         return model[row];
     }
 
+    // Copies every row, only meant for small models
     std::vector<Item> getModel() const
     {
-        return model;
+        return std::vector<Item>(model.begin(), model.end());
     }
 
     void clearModel()
     {
         if (!model.empty())
         {
+            invalidateSort();
             emit beginRemoveRows(QModelIndex(), 0, rowCount() - 1);
             model.clear();
-            model.shrink_to_fit();
             emit endRemoveRows();
         }
     }
@@ -91,7 +117,91 @@ public:
     }
 
 protected:
-    std::vector<Item> model;
+    ChunkedVector<Item> model;
+
+    // Sorts the rows by the key of each item on a background thread and reorders them once done.
+    // The key type only needs operator<, e.g. integers for PIDs and advances or DateTime for searcher results.
+    template <class Key>
+    void sortItems(Qt::SortOrder order, Key key)
+    {
+        u32 generation = ++sortGeneration;
+        if (model.empty())
+        {
+            return;
+        }
+
+        using Value = std::decay_t<decltype(key(model[0]))>;
+
+        // The keys are copied out here so the sort thread never reads rows that can change under it
+        std::vector<std::pair<Value, u32>> keys;
+        keys.reserve(model.size());
+        for (size_t i = 0; i < model.size(); i++)
+        {
+            keys.emplace_back(key(model[i]), static_cast<u32>(i));
+        }
+
+        bool ascending = order == Qt::AscendingOrder;
+        auto rows = std::make_shared<std::vector<u32>>();
+        QThread *thread = QThread::create([keys = std::move(keys), ascending, rows]() mutable {
+            *rows = sortRows(std::move(keys), ascending);
+        });
+        connect(thread, &QThread::finished, this, [=] { applySort(generation, *rows); });
+        connect(thread, &QThread::finished, thread, &QObject::deleteLater);
+        thread->start();
+    }
+
+private:
+    u32 sortGeneration = 0;
+
+    template <class Value>
+    static std::vector<u32> sortRows(std::vector<std::pair<Value, u32>> keys, bool ascending)
+    {
+        // Ties keep their current order so repeated sorts are stable
+        parallelSort(keys.begin(), keys.end(), [ascending](const std::pair<Value, u32> &left, const std::pair<Value, u32> &right) {
+            if (left.first < right.first)
+            {
+                return ascending;
+            }
+            if (right.first < left.first)
+            {
+                return !ascending;
+            }
+            return left.second < right.second;
+        });
+
+        std::vector<u32> rows;
+        rows.reserve(keys.size());
+        for (const auto &entry : keys)
+        {
+            rows.emplace_back(entry.second);
+        }
+        return rows;
+    }
+
+    void applySort(u32 generation, const std::vector<u32> &rows)
+    {
+        // The rows changed or another sort started since this one began
+        if (generation != sortGeneration)
+        {
+            return;
+        }
+
+        ChunkedVector<Item> sorted;
+        for (u32 row : rows)
+        {
+            sorted.emplace_back(std::move(model[row]));
+        }
+
+        emit layoutAboutToBeChanged();
+        std::swap(model, sorted);
+        emit layoutChanged();
+    }
+
+    // A running sort is left to finish on its own, its result is dropped once it arrives
+    void invalidateSort()
+    {
+        sortGeneration++;
+    }
 };
 
 #endif // TABLEMODEL_HPP
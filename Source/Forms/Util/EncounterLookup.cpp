@@ -21,12 +21,7 @@
 #include "ui_EncounterLookup.h"
 #include <Core/Enum/Encounter.hpp>
 #include <Core/Enum/Game.hpp>
-#include <Core/Gen3/EncounterArea3.hpp>
-#include <Core/Gen3/Encounters3.hpp>
-#include <Core/Gen3/Profile3.hpp>
-#include <Core/Gen4/EncounterArea4.hpp>
-#include <Core/Gen4/Encounters4.hpp>
-#include <Core/Gen4/Profile4.hpp>
+#include <Core/Util/EncounterIndex.hpp>
 #include <Core/Util/Translator.hpp>
 #include <QCompleter>
 #include <QSettings>
@@ -83,93 +78,6 @@ void EncounterLookup::setupModels()
     }
 }
 
-std::set<std::pair<u8, QString>> EncounterLookup::getEncounters3(Game game, u16 specie)
-{
-    std::set<std::pair<u8, QString>> encounters;
-    Profile3 profile("", game, 0, 0);
-
-    // Encounter variables to iterate through
-    auto types
-        = { Encounter::Grass, Encounter::SafariZone, Encounter::RockSmash, Encounter::OldRod, Encounter::GoodRod, Encounter::SuperRod };
-
-    for (const auto &type : types)
-    {
-        auto areas = Encounters3::getEncounters(type, profile);
-        for (const auto &area : areas)
-        {
-            std::vector<Slot> pokemon = area.getPokemon();
-            if (std::any_of(pokemon.begin(), pokemon.end(), [specie](const auto &entry) { return entry.getSpecie() == specie; }))
-            {
-                QString info = getEncounterString(type);
-                std::pair<u8, u8> range = area.getLevelRange(specie);
-                info += QString("/%1-%2").arg(range.first).arg(range.second);
-                encounters.insert(std::make_pair(area.getLocation(), info));
-            }
-        }
-    }
-
-    return encounters;
-}
-
-std::set<std::pair<u8, QString>> EncounterLookup::getEncounters4(Game game, u16 specie)
-{
-    std::set<std::pair<u8, QString>> encounters;
-    std::vector<Profile4> profiles;
-
-    // Encounter variables to iterate through
-    auto types = { Encounter::Grass, Encounter::RockSmash, Encounter::OldRod, Encounter::GoodRod, Encounter::SuperRod };
-
-    // Setup profiles to iterate through of the different combinations of possibilities depending on HGSS vs DPPt
-    if (game & Game::HGSS)
-    {
-        for (const int radio : { 0, 1, 2 })
-        {
-            for (const bool swarm : { false, true })
-            {
-                profiles.emplace_back("", game, 0, 0, Game::Blank, radio, false, swarm);
-            }
-        }
-    }
-    else
-    {
-        auto duals = { Game::Emerald, Game::Ruby, Game::Sapphire, Game::FireRed, Game::LeafGreen };
-        for (const Game dual : duals)
-        {
-            for (const bool swarm : { false, true })
-            {
-                for (const bool radar : { false, true })
-                {
-                    profiles.emplace_back("", game, 0, 0, dual, 0, radar, swarm);
-                }
-            }
-        }
-    }
-
-    for (const auto &profile : profiles)
-    {
-        for (const auto type : types)
-        {
-            for (const auto &time : { 0, 1, 2 })
-            {
-                auto areas = Encounters4::getEncounters(type, time, profile);
-                for (const auto &area : areas)
-                {
-                    auto pokemon = area.getPokemon();
-                    if (std::any_of(pokemon.begin(), pokemon.end(), [specie](const auto &entry) { return entry.getSpecie() == specie; }))
-                    {
-                        QString info = getEncounterString(type);
-                        std::pair<u8, u8> range = area.getLevelRange(specie);
-                        info += QString("/%1-%2").arg(range.first).arg(range.second);
-                        encounters.insert(std::make_pair(area.getLocation(), info));
-                    }
-                }
-            }
-        }
-    }
-
-    return encounters;
-}
-
 QString EncounterLookup::getEncounterString(Encounter type)
 {
     switch (type)
@@ -199,29 +107,21 @@ void EncounterLookup::find()
 
     Game game = static_cast<Game>(ui->comboBoxGame->currentData().toInt());
     u16 specie = static_cast<u16>(ui->comboBoxPokemon->currentIndex() + 1);
-    std::set<std::pair<u8, QString>> encounters;
-    std::vector<std::string> locationNames;
-
-    if (game & Game::FRLG || game & Game::RSE)
-    {
-        encounters = getEncounters3(game, specie);
-    }
-    else if (game & Game::DPPt || game & Game::HGSS)
-    {
-        encounters = getEncounters4(game, specie);
-    }
+    const auto &encounters = EncounterIndex::getLocations(game, specie);
 
     std::vector<u8> locations;
     std::transform(encounters.begin(), encounters.end(), std::back_inserter(locations),
-                   [](const std::pair<u8, QString> &encounter) { return encounter.first; });
-    locationNames = Translator::getLocations(locations, game);
+                   [](const SpeciesLocation &encounter) { return encounter.getLocation(); });
+    std::vector<std::string> locationNames = Translator::getLocations(locations, game);
 
-    u16 i = 0;
-    for (const auto &encounter : encounters)
+    for (size_t i = 0; i < encounters.size(); i++)
     {
+        const SpeciesLocation &encounter = encounters[i];
+
         QList<QStandardItem *> row;
-        QStringList split = encounter.second.split('/');
-        row << new QStandardItem(QString::fromStdString(locationNames[i++])) << new QStandardItem(split[0]) << new QStandardItem(split[1]);
+        row << new QStandardItem(QString::fromStdString(locationNames[i]));
+        row << new QStandardItem(getEncounterString(encounter.getEncounter()));
+        row << new QStandardItem(QString("%1-%2").arg(encounter.getMinLevel()).arg(encounter.getMaxLevel()));
         model->appendRow(row);
     }
 }
@@ -22,7 +22,6 @@
 
 #include <Core/Util/Global.hpp>
 #include <QWidget>
-#include <set>
 
 class QStandardItemModel;
 enum Encounter : u8;
@@ -45,8 +44,6 @@ private:
     QStandardItemModel *model = nullptr;
 
     void setupModels();
-    std::set<std::pair<u8, QString>> getEncounters3(Game game, u16 specie);
-    std::set<std::pair<u8, QString>> getEncounters4(Game game, u16 specie);
     QString getEncounterString(Encounter type);
 
 private slots:
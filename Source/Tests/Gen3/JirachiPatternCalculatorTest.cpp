@@ -0,0 +1,68 @@
+#include "JirachiPatternCalculatorTest.hpp"
+#include <Core/Gen3/Tools/JirachiPatternCalculator.hpp>
+#include <QTest>
+#include <QVector>
+#include <algorithm>
+#include <array>
+
+void JirachiPatternCalculatorTest::patterns_data()
+{
+    QTest::addColumn<u32>("seed");
+    QTest::addColumn<QVector<u64>>("results");
+
+    QTest::newRow("None") << 0x12345678U << QVector<u64>();
+    QTest::newRow("One") << 0x1237567BU << QVector<u64>(1, 0x88791D9DBEBE7C9A);
+    QTest::newRow("Two") << 0x123B567FU << QVector<u64>({ 0x7740086C38379AAD, 0x8740086C38379AAD });
+    QTest::newRow("Three") << 0x129256D6U << QVector<u64>({ 0x6ED1165E82B6D938, 0x7ED1165E82B6D938, 0x8ED1165E82B6D938 });
+}
+
+void JirachiPatternCalculatorTest::patterns()
+{
+    QFETCH(u32, seed);
+    QFETCH(QVector<u64>, results);
+
+    u64 compact[3];
+    u8 count = JirachiPatternCalculator::getPatterns(seed, compact);
+    QCOMPARE(std::vector<u64>(compact, compact + count), std::vector<u64>(results.begin(), results.end()));
+
+    auto strings = JirachiPatternCalculator::getPatterns(seed);
+    QCOMPARE(strings.size(), static_cast<size_t>(count));
+    for (u8 i = 0; i < count; i++)
+    {
+        QCOMPARE(strings[i], JirachiPatternCalculator::getPatternString(compact[i]));
+
+        // Rebuilding the pattern from the displayed menu values gives back the same key
+        std::array<u8, 30> menu;
+        for (u8 j = 0; j < 30; j++)
+        {
+            menu[j] = (compact[i] >> (2 * (29 - j))) & 3;
+        }
+        QCOMPARE(JirachiPatternCalculator::getPattern(menu, compact[i] >> 60), compact[i]);
+    }
+}
+
+void JirachiPatternCalculatorTest::patternIndex()
+{
+    std::vector<u32> seeds;
+    for (u32 seed = 0x12345678; seeds.size() < 5000; seed += 0x10001)
+    {
+        seeds.emplace_back(seed);
+    }
+
+    auto index = JirachiPatternCalculator::getPatternIndex(seeds, 4);
+    QCOMPARE(index.size(), JirachiPatternCalculator::getPatterns(seeds, 1).size());
+
+    size_t total = 0;
+    for (u32 seed : seeds)
+    {
+        u64 compact[3];
+        u8 count = JirachiPatternCalculator::getPatterns(seed, compact);
+        for (u8 i = 0; i < count; i++)
+        {
+            auto found = JirachiPatternCalculator::getSeeds(index, compact[i]);
+            QVERIFY(std::find(found.begin(), found.end(), seed) != found.end());
+        }
+        total += count;
+    }
+    QCOMPARE(index.size(), total);
+}
@@ -0,0 +1,16 @@
+#ifndef JIRACHIPATTERNCALCULATORTEST_HPP
+#define JIRACHIPATTERNCALCULATORTEST_HPP
+
+#include <QObject>
+
+class JirachiPatternCalculatorTest : public QObject
+{
+    Q_OBJECT
+private slots:
+    void patterns_data();
+    void patterns();
+
+    void patternIndex();
+};
+
+#endif // JIRACHIPATTERNCALCULATORTEST_HPP
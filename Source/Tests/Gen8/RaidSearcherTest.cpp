@@ -0,0 +1,66 @@
+#include "RaidSearcherTest.hpp"
+#include <Core/Enum/Game.hpp>
+#include <Core/Gen8/Den.hpp>
+#include <Core/Gen8/DenLoader.hpp>
+#include <Core/Gen8/Generators/RaidGenerator.hpp>
+#include <Core/Gen8/Searchers/RaidSearcher.hpp>
+#include <Core/Parents/Filters/StateFilter.hpp>
+#include <Core/RNG/Xoroshiro.hpp>
+#include <QTest>
+#include <algorithm>
+
+void RaidSearcherTest::search_data()
+{
+    QTest::addColumn<u64>("seed");
+    QTest::addColumn<u16>("den");
+    QTest::addColumn<u8>("count");
+    QTest::addColumn<bool>("forced");
+
+    QTest::newRow("1 raid") << 0xC11F6531EB66D9A7ULL << u16(50) << u8(1) << false;
+    QTest::newRow("2 raids") << 0x242A5F87D0A7DEDDULL << u16(28) << u8(2) << false;
+    QTest::newRow("3 raids") << 0x41D51C773E6F53E1ULL << u16(40) << u8(3) << false;
+    QTest::newRow("1 raid forced shiny") << 0x65BEFC3CA8D0CB6FULL << u16(54) << u8(1) << true;
+    QTest::newRow("2 raids forced shiny") << 0xAABE336043197207ULL << u16(66) << u8(2) << true;
+    QTest::newRow("3 raids forced shiny") << 0x0AA943B1D97B7F18ULL << u16(57) << u8(3) << true;
+}
+
+void RaidSearcherTest::search()
+{
+    QFETCH(u64, seed);
+    QFETCH(u16, den);
+    QFETCH(u8, count);
+    QFETCH(bool, forced);
+
+    u16 tid = 12345;
+    u16 sid = 54321;
+    StateFilter filter(255, 255, 255, false, { 0, 0, 0, 0, 0, 0 }, { 31, 31, 31, 31, 31, 31 }, std::vector<bool>(25, true),
+                       std::vector<bool>(16, true), {});
+
+    // Raid i of a den is generated from the seed advanced i times
+    std::vector<Raid> raids;
+    std::vector<u32> ecs;
+    std::vector<State> states;
+    for (u8 i = 0; i < count; i++)
+    {
+        Raid raid = DenLoader::getDen(den, 0).getRaid(i * 3, Game::Sword);
+        if (forced && i == 0)
+        {
+            raid = Raid(raid.getAbility(), raid.getAltForm(), raid.getIVCount(), raid.getGender(), raid.getGigantamax(), raid.getSpecies(),
+                        raid.getInfo(), std::array<bool, 5>(), 2);
+        }
+
+        RaidGenerator generator(i, 0, tid, sid, filter, raid);
+        Xoroshiro rng(seed + 0x82A2B175229D6A5B * i);
+
+        raids.emplace_back(raid);
+        ecs.emplace_back(rng.nextInt<0xffffffff>());
+        states.emplace_back(generator.generate(seed).front());
+    }
+
+    RaidSearcher searcher(tid, sid, raids, ecs, states);
+    searcher.startSearch(2);
+
+    auto results = searcher.getResults();
+    QVERIFY(std::find(results.begin(), results.end(), seed) != results.end());
+    QVERIFY(searcher.getResults().empty());
+}
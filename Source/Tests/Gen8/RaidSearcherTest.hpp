@@ -0,0 +1,14 @@
+#ifndef RAIDSEARCHERTEST_HPP
+#define RAIDSEARCHERTEST_HPP
+
+#include <QObject>
+
+class RaidSearcherTest : public QObject
+{
+    Q_OBJECT
+private slots:
+    void search_data();
+    void search();
+};
+
+#endif // RAIDSEARCHERTEST_HPP
@@ -50,6 +50,30 @@ void LCRNGTest::advance()
     QCOMPARE(xdrngr.getSeed(), results[5]);
 }
 
+void LCRNGTest::distance_data()
+{
+    QTest::addColumn<u32>("seed");
+    QTest::addColumn<u32>("advances");
+
+    QTest::newRow("Distance 1") << 0x00000000U << 5U;
+    QTest::newRow("Distance 2") << 0x80000000U << 1000U;
+    QTest::newRow("Distance 3") << 0x12345678U << 123456U;
+    QTest::newRow("Distance 4") << 0xFFFFFFFFU << 70000U;
+}
+
+void LCRNGTest::distance()
+{
+    QFETCH(u32, seed);
+    QFETCH(u32, advances);
+
+    QCOMPARE(ARNG::distance(seed, ARNG::advance(seed, advances)), advances);
+    QCOMPARE(ARNGR::distance(seed, ARNGR::advance(seed, advances)), advances);
+    QCOMPARE(PokeRNG::distance(seed, PokeRNG::advance(seed, advances)), advances);
+    QCOMPARE(PokeRNGR::distance(seed, PokeRNGR::advance(seed, advances)), advances);
+    QCOMPARE(XDRNG::distance(seed, XDRNG::advance(seed, advances)), advances);
+    QCOMPARE(XDRNGR::distance(seed, XDRNGR::advance(seed, advances)), advances);
+}
+
 void LCRNGTest::next_data()
 {
     QTest::addColumn<u32>("seed");
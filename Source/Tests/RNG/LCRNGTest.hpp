@@ -10,6 +10,9 @@ private slots:
     void advance_data();
     void advance();
 
+    void distance_data();
+    void distance();
+
     void next_data();
     void next();
 };
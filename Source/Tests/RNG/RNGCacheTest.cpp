@@ -34,6 +34,37 @@ void RNGCacheTest::ivs()
     QCOMPARE(cache.recoverLower16BitsIV(ivs[0], ivs[1], ivs[2], ivs[3], ivs[4], ivs[5]), std::vector<u32>(results.begin(), results.end()));
 }
 
+void RNGCacheTest::ivsBatch_data()
+{
+    QTest::addColumn<Method>("method");
+    QTest::addColumn<QVector<u8>>("counts");
+    QTest::addColumn<QVector<u32>>("results");
+
+    QTest::newRow("Method 1/2") << Method::Method1 << QVector<u8>({ 3, 2, 2 })
+                                << QVector<u32>({ 0x7FFF305A, 0x7FFF982D, 0x7FFFF961, 0x7FFF753B, 0x7FFFDD0E, 0x7C1F0DEC, 0x7C1F75BF });
+    QTest::newRow("Method 4") << Method::Method4 << QVector<u8>({ 2, 2, 1 })
+                              << QVector<u32>({ 0x7FFF52E5, 0x7FFF8D6E, 0x7FFFA85E, 0x7FFFE2E7, 0x7C1FF9B6 });
+}
+
+void RNGCacheTest::ivsBatch()
+{
+    QFETCH(Method, method);
+    QFETCH(QVector<u8>, counts);
+    QFETCH(QVector<u32>, results);
+
+    std::array<std::array<u8, 6>, 3> ivs = { std::array<u8, 6> { 31, 31, 31, 31, 31, 31 }, std::array<u8, 6> { 31, 31, 31, 0, 31, 31 },
+                                             std::array<u8, 6> { 31, 0, 31, 31, 31, 31 } };
+    std::vector<u32> seeds(ivs.size() * RNGCache::maxSeeds);
+    std::vector<u8> seedCounts(ivs.size());
+
+    RNGCache cache(method);
+    size_t total = cache.recoverLower16BitsIV(ivs.data(), ivs.size(), seeds.data(), seedCounts.data());
+    seeds.resize(total);
+
+    QCOMPARE(seedCounts, std::vector<u8>(counts.begin(), counts.end()));
+    QCOMPARE(seeds, std::vector<u32>(results.begin(), results.end()));
+}
+
 void RNGCacheTest::pid_data()
 {
     QTest::addColumn<Method>("method");
@@ -33,6 +33,43 @@ void RNGEuclideanTest::ivs()
     QCOMPARE(RNGEuclidean::recoverLower16BitsIV(ivs[0], ivs[1], ivs[2], ivs[3], ivs[4], ivs[5]), convert);
 }
 
+void RNGEuclideanTest::ivsBatch_data()
+{
+    QTest::addColumn<QVector<u8>>("counts");
+    QTest::addColumn<QVector<QPair<u32, u32>>>("results");
+
+    QTest::newRow("Batch") << QVector<u8>({ 3, 2, 2 })
+                           << QVector<QPair<u32, u32>>({ qMakePair(0x7FFF14C6, 0x7FFFF871), qMakePair(0x7FFF8A5D, 0xFFFFB3AC),
+                                                         qMakePair(0x7FFFFFF4, 0x7FFF6EE7), qMakePair(0x7FFF1396, 0x7C1F3C01),
+                                                         qMakePair(0x7FFFD792, 0xFC1FE00D), qMakePair(0x7C1F3869, 0x7FFFD988),
+                                                         qMakePair(0x7C1FAE00, 0xFFFF94C3) });
+}
+
+void RNGEuclideanTest::ivsBatch()
+{
+    using Results = QVector<QPair<u32, u32>>;
+
+    QFETCH(QVector<u8>, counts);
+    QFETCH(Results, results);
+
+    std::array<std::array<u8, 6>, 3> ivs = { std::array<u8, 6> { 31, 31, 31, 31, 31, 31 }, std::array<u8, 6> { 31, 31, 31, 0, 31, 31 },
+                                             std::array<u8, 6> { 31, 0, 31, 31, 31, 31 } };
+    std::vector<std::pair<u32, u32>> seeds(ivs.size() * 7);
+    std::vector<u8> seedCounts(ivs.size());
+
+    size_t total = RNGEuclidean::recoverLower16BitsIV(ivs.data(), ivs.size(), seeds.data(), seedCounts.data());
+    seeds.resize(total);
+
+    std::vector<std::pair<u32, u32>> convert;
+    for (const auto &result : results)
+    {
+        convert.emplace_back(result.first, result.second);
+    }
+
+    QCOMPARE(seedCounts, std::vector<u8>(counts.begin(), counts.end()));
+    QCOMPARE(seeds, convert);
+}
+
 void RNGEuclideanTest::pid_data()
 {
     QTest::addColumn<u32>("pid");
@@ -10,6 +10,9 @@ private slots:
     void ivs_data();
     void ivs();
 
+    void ivsBatch_data();
+    void ivsBatch();
+
     void pid_data();
     void pid();
 
@@ -0,0 +1,58 @@
+#include "XorshiftTest.hpp"
+#include <Core/RNG/Xorshift.hpp>
+#include <QTest>
+#include <QVector>
+
+void XorshiftTest::advance_data()
+{
+    QTest::addColumn<u64>("seed0");
+    QTest::addColumn<u64>("seed1");
+    QTest::addColumn<u32>("advances");
+    QTest::addColumn<QVector<u32>>("results");
+
+    QTest::newRow("Advance 1") << 0x0000000000000000ULL << 0x0000000000000001ULL << 5U
+                               << QVector<u32>({ 0x00000809, 0x00000000, 0x00000809, 0x00000809 });
+    QTest::newRow("Advance 2") << 0x0123456789ABCDEFULL << 0xFEDCBA9876543210ULL << 1000U
+                               << QVector<u32>({ 0x87077D05, 0xBA1A7B9F, 0xD423790F, 0x494481E5 });
+    QTest::newRow("Advance 3") << 0x0123456789ABCDEFULL << 0xFEDCBA9876543210ULL << 1000000U
+                               << QVector<u32>({ 0x2219597A, 0x4677417E, 0xB53B0102, 0x4F8E13C0 });
+    QTest::newRow("Advance 4") << 0xFFFFFFFFFFFFFFFFULL << 0x1234567812345678ULL << 123456789U
+                               << QVector<u32>({ 0x69E3BD29, 0x1834AB2C, 0xB46EF45F, 0xEBB9833D });
+}
+
+void XorshiftTest::advance()
+{
+    QFETCH(u64, seed0);
+    QFETCH(u64, seed1);
+    QFETCH(u32, advances);
+    QFETCH(QVector<u32>, results);
+
+    Xorshift rng(seed0, seed1);
+    rng.advance(advances);
+    QCOMPARE(QVector<u32>({ rng.state[0], rng.state[1], rng.state[2], rng.state[3] }), results);
+}
+
+void XorshiftTest::distance_data()
+{
+    QTest::addColumn<u64>("seed0");
+    QTest::addColumn<u64>("seed1");
+    QTest::addColumn<u32>("advances");
+
+    QTest::newRow("Distance 1") << 0x0000000000000000ULL << 0x0000000000000001ULL << 0U;
+    QTest::newRow("Distance 2") << 0x0123456789ABCDEFULL << 0xFEDCBA9876543210ULL << 1000U;
+    QTest::newRow("Distance 3") << 0x0123456789ABCDEFULL << 0xFEDCBA9876543210ULL << 70000U;
+    QTest::newRow("Distance 4") << 0xFFFFFFFFFFFFFFFFULL << 0x1234567812345678ULL << 123456789U;
+}
+
+void XorshiftTest::distance()
+{
+    QFETCH(u64, seed0);
+    QFETCH(u64, seed1);
+    QFETCH(u32, advances);
+
+    Xorshift start(seed0, seed1);
+    Xorshift end(start);
+    end.advance(advances);
+
+    QCOMPARE(Xorshift::distance(start, end), advances);
+}
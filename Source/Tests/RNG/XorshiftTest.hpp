@@ -0,0 +1,17 @@
+#ifndef XORSHIFTTEST_HPP
+#define XORSHIFTTEST_HPP
+
+#include <QObject>
+
+class XorshiftTest : public QObject
+{
+    Q_OBJECT
+private slots:
+    void advance_data();
+    void advance();
+
+    void distance_data();
+    void distance();
+};
+
+#endif // XORSHIFTTEST_HPP
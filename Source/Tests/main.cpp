@@ -1,5 +1,7 @@
 #include <QDebug>
 #include <QTest>
+#include <Tests/Gen3/JirachiPatternCalculatorTest.hpp>
+#include <Tests/Gen8/RaidSearcherTest.hpp>
 #include <Tests/RNG/LCRNG64Test.hpp>
 #include <Tests/RNG/LCRNGTest.hpp>
 #include <Tests/RNG/MTTest.hpp>
@@ -8,6 +10,7 @@
 #include <Tests/RNG/SFMTTest.hpp>
 #include <Tests/RNG/SHA1Test.hpp>
 #include <Tests/RNG/TinyMTTest.hpp>
+#include <Tests/RNG/XorshiftTest.hpp>
 
 template <class Testname>
 int runTest(QStringList &fails)
@@ -37,6 +40,13 @@ int main()
     status += runTest<SFMTTest>(fails);
     status += runTest<SHA1Test>(fails);
     status += runTest<TinyMTTest>(fails);
+    status += runTest<XorshiftTest>(fails);
+
+    // Gen 3 Tests
+    status += runTest<JirachiPatternCalculatorTest>(fails);
+
+    // Gen 8 Tests
+    status += runTest<RaidSearcherTest>(fails);
 
     qDebug() << "";
     // Summary of failures at end for easy viewing